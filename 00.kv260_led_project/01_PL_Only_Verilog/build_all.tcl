@@ -5,6 +5,8 @@
 
 set project_dir [file dirname [info script]]
 set project_name "kv260_led_pl_only"
+set variant_name "pl_only_verilog"
+set build_start  [clock seconds]
 
 #------------------------------------------------------------------------------
 # Open Project
@@ -64,6 +66,25 @@ if {[file exists $bit_file]} {
     puts "Bitstream copied to: $project_dir/design_1_wrapper.bit"
 }
 
+#------------------------------------------------------------------------------
+# Reports (WNS/TNS, Fmax, utilization -> build_summary.json)
+#------------------------------------------------------------------------------
+puts "======================================"
+puts " Writing Reports..."
+puts "======================================"
+
+set report_dir "$project_dir/reports"
+file mkdir $report_dir
+
+open_run impl_1
+report_timing_summary -file $report_dir/timing_summary.rpt
+report_utilization -file $report_dir/utilization.rpt
+
+source $project_dir/../../tools/report_summary.tcl
+report_summary::write $variant_name \
+    $report_dir/timing_summary.rpt $report_dir/utilization.rpt \
+    [expr {[clock seconds] - $build_start}] $project_dir/build_summary.json
+
 #------------------------------------------------------------------------------
 # Done
 #------------------------------------------------------------------------------
@@ -72,6 +93,7 @@ puts "======================================"
 puts " BUILD COMPLETED!"
 puts "======================================"
 puts " Bitstream: $project_dir/design_1_wrapper.bit"
+puts " Summary:   $project_dir/build_summary.json"
 puts ""
 puts " To program FPGA:"
 puts "   1. Open Hardware Manager"
@@ -5,6 +5,8 @@
 
 set project_dir [file dirname [info script]]
 set project_name "kv260_led_ps_pl"
+set variant_name "ps_pl_verilog"
+set build_start  [clock seconds]
 
 #------------------------------------------------------------------------------
 # Open Project
@@ -64,6 +66,25 @@ if {[file exists $bit_file]} {
     puts "Bitstream copied to: $project_dir/design_1_wrapper.bit"
 }
 
+#------------------------------------------------------------------------------
+# Reports (WNS/TNS, Fmax, utilization -> build_summary.json)
+#------------------------------------------------------------------------------
+puts "======================================"
+puts " Writing Reports..."
+puts "======================================"
+
+set report_dir "$project_dir/reports"
+file mkdir $report_dir
+
+open_run impl_1
+report_timing_summary -file $report_dir/timing_summary.rpt
+report_utilization -file $report_dir/utilization.rpt
+
+source $project_dir/../../tools/report_summary.tcl
+report_summary::write $variant_name \
+    $report_dir/timing_summary.rpt $report_dir/utilization.rpt \
+    [expr {[clock seconds] - $build_start}] $project_dir/build_summary.json
+
 #------------------------------------------------------------------------------
 # Export XSA (for Vitis)
 #------------------------------------------------------------------------------
@@ -90,6 +111,7 @@ puts "======================================"
 puts " Output files:"
 puts "   Bitstream: $project_dir/design_1_wrapper.bit"
 puts "   XSA:       $xsa_file"
+puts "   Summary:   $project_dir/build_summary.json"
 puts ""
 puts " Next steps:"
 puts "   1. Go to 03_Vitis_App folder"
@@ -0,0 +1,9 @@
+/*==============================================================================
+ * Host stub - sleep.h
+ *============================================================================*/
+#ifndef HOST_SLEEP_H
+#define HOST_SLEEP_H
+
+#include <unistd.h>
+
+#endif /* HOST_SLEEP_H */
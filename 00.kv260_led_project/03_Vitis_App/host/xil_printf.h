@@ -0,0 +1,20 @@
+/*==============================================================================
+ * Host stub - xil_printf.h
+ *============================================================================*/
+#ifndef HOST_XIL_PRINTF_H
+#define HOST_XIL_PRINTF_H
+
+#include <stdio.h>
+
+#define xil_printf  printf
+
+static inline char inbyte(void)
+{
+    int c;
+
+    fflush(stdout);
+    c = getchar();
+    return (c == EOF) ? 'q' : (char)c;
+}
+
+#endif /* HOST_XIL_PRINTF_H */
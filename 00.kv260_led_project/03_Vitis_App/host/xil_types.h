@@ -0,0 +1,21 @@
+/*==============================================================================
+ * Host stub - xil_types.h
+ *
+ * Minimal replacement for the Xilinx standalone BSP so main.c can be
+ * compiled and benchmarked on a Linux/Windows host without a board.
+ *============================================================================*/
+#ifndef HOST_XIL_TYPES_H
+#define HOST_XIL_TYPES_H
+
+#include <stdint.h>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t  s32;
+
+#define XST_SUCCESS     0L
+#define XST_FAILURE     1L
+
+#endif /* HOST_XIL_TYPES_H */
@@ -0,0 +1,10 @@
+/*==============================================================================
+ * Host stub - xparameters.h
+ *============================================================================*/
+#ifndef HOST_XPARAMETERS_H
+#define HOST_XPARAMETERS_H
+
+#define XPAR_AXI_GPIO_0_DEVICE_ID   0
+#define XPAR_AXI_GPIO_0_BASEADDR    0x80000000U
+
+#endif /* HOST_XPARAMETERS_H */
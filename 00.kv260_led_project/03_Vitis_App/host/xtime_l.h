@@ -0,0 +1,24 @@
+/*==============================================================================
+ * Host stub - xtime_l.h
+ *
+ * XTime counts nanoseconds from CLOCK_MONOTONIC.
+ *============================================================================*/
+#ifndef HOST_XTIME_L_H
+#define HOST_XTIME_L_H
+
+#include <time.h>
+#include "xil_types.h"
+
+typedef u64 XTime;
+
+#define COUNTS_PER_SECOND   1000000000ULL
+
+static inline void XTime_GetTime(XTime *Xtime_Global)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    *Xtime_Global = (XTime)ts.tv_sec * COUNTS_PER_SECOND + (XTime)ts.tv_nsec;
+}
+
+#endif /* HOST_XTIME_L_H */
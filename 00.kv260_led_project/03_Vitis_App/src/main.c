@@ -8,6 +8,9 @@
  *   1: Blink (1Hz)
  *   2: Counter (10Hz)
  *   3: Knight Rider
+ *
+ * Host build (stub XGpio, no board needed):
+ *   gcc -O2 -Ihost -o led_control_host src/main.c
  *============================================================================*/
 
 #include <stdio.h>
@@ -15,6 +18,7 @@
 #include "xgpio.h"
 #include "xil_printf.h"
 #include "sleep.h"
+#include "xtime_l.h"
 
 /*------------------------------------------------------------------------------
  * Definitions
@@ -26,19 +30,48 @@
 #define MODE_BLINK      1
 #define MODE_COUNTER    2
 #define MODE_KNIGHT     3
+#define MODE_MASK       0x03
+
+#define SEQ_MAX_STEPS   32
+#define BENCH_FAST_ITER 100000
+#define BENCH_LOG_ITER  200
+
+/*------------------------------------------------------------------------------
+ * Types
+ *----------------------------------------------------------------------------*/
+/* One entry of a timed mode sequence */
+typedef struct {
+    u8  mode;
+    u32 hold_us;        /* time to stay in this mode (0 = no wait) */
+} ModeStep;
 
 /*------------------------------------------------------------------------------
  * Global Variables
  *----------------------------------------------------------------------------*/
 XGpio Gpio;
 
+/* Demo sequence for option 'S' (fast sweep, then back to OFF) */
+static const ModeStep DemoSequence[] = {
+    { MODE_BLINK,   500000 },
+    { MODE_COUNTER, 500000 },
+    { MODE_KNIGHT,  500000 },
+    { MODE_COUNTER, 250000 },
+    { MODE_BLINK,   250000 },
+    { MODE_OFF,     0      },
+};
+
 /*------------------------------------------------------------------------------
  * Function Prototypes
  *----------------------------------------------------------------------------*/
 int InitGpio(void);
 void SetMode(u8 mode);
+void SetModeFast(u8 mode);
+int SetModeVerified(u8 mode);
+int RunModeSequence(const ModeStep *steps, u32 count, int verify);
 void PrintMenu(void);
 void RunDemo(void);
+void RunSequenceDemo(void);
+void RunModeBenchmark(void);
 
 /*------------------------------------------------------------------------------
  * Main
@@ -98,6 +131,18 @@ int main(void)
                 RunDemo();
                 break;
                 
+            case 's':
+            case 'S':
+                xil_printf("Running Sequence (verified)...\r\n");
+                RunSequenceDemo();
+                break;
+                
+            case 'b':
+            case 'B':
+                xil_printf("Running Mode-Switch Benchmark...\r\n");
+                RunModeBenchmark();
+                break;
+                
             case 'q':
             case 'Q':
                 xil_printf("Exiting. LED OFF.\r\n");
@@ -136,8 +181,62 @@ int InitGpio(void)
  *----------------------------------------------------------------------------*/
 void SetMode(u8 mode)
 {
-    XGpio_DiscreteWrite(&Gpio, GPIO_CHANNEL, mode & 0x03);
-    xil_printf("  -> Mode register: 0x%02X\r\n", mode & 0x03);
+    SetModeFast(mode);
+    xil_printf("  -> Mode register: 0x%02X\r\n", mode & MODE_MASK);
+}
+
+/*------------------------------------------------------------------------------
+ * Set LED Mode - no logging (high-rate path)
+ *----------------------------------------------------------------------------*/
+void SetModeFast(u8 mode)
+{
+    XGpio_DiscreteWrite(&Gpio, GPIO_CHANNEL, mode & MODE_MASK);
+}
+
+/*------------------------------------------------------------------------------
+ * Set LED Mode and read back the GPIO data register
+ * Returns XST_SUCCESS if the register holds the written value.
+ *----------------------------------------------------------------------------*/
+int SetModeVerified(u8 mode)
+{
+    u32 readback;
+
+    SetModeFast(mode);
+    readback = XGpio_DiscreteRead(&Gpio, GPIO_CHANNEL) & MODE_MASK;
+
+    return (readback == (u32)(mode & MODE_MASK)) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*------------------------------------------------------------------------------
+ * Run a timed mode sequence without per-step logging
+ * Returns the number of steps whose read-back did not match (0 if verify=0),
+ * or -1 without touching the GPIO if count exceeds SEQ_MAX_STEPS.
+ *----------------------------------------------------------------------------*/
+int RunModeSequence(const ModeStep *steps, u32 count, int verify)
+{
+    u32 i;
+    int errors = 0;
+
+    if (count > SEQ_MAX_STEPS) {
+        xil_printf("ERROR: sequence has %u steps (max %u)\r\n", count, (u32)SEQ_MAX_STEPS);
+        return -1;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (verify) {
+            if (SetModeVerified(steps[i].mode) != XST_SUCCESS) {
+                errors++;
+            }
+        } else {
+            SetModeFast(steps[i].mode);
+        }
+
+        if (steps[i].hold_us > 0) {
+            usleep(steps[i].hold_us);
+        }
+    }
+
+    return errors;
 }
 
 /*------------------------------------------------------------------------------
@@ -154,6 +253,8 @@ void PrintMenu(void)
     xil_printf("  2: COUNTER (Binary 10Hz)\r\n");
     xil_printf("  3: KNIGHT RIDER\r\n");
     xil_printf("  D: Demo (cycle all modes)\r\n");
+    xil_printf("  S: Sequence (timed, read-back verified)\r\n");
+    xil_printf("  B: Benchmark mode-switch rate\r\n");
     xil_printf("  Q: Quit\r\n");
     xil_printf("------------------------------------------\r\n");
     xil_printf("Select: ");
@@ -181,3 +282,80 @@ void RunDemo(void)
     
     xil_printf("\r\nDemo Complete.\r\n");
 }
+
+/*------------------------------------------------------------------------------
+ * Run Sequence Demo - queued steps, log only the summary
+ *----------------------------------------------------------------------------*/
+void RunSequenceDemo(void)
+{
+    u32 count = sizeof(DemoSequence) / sizeof(DemoSequence[0]);
+    int errors;
+
+    errors = RunModeSequence(DemoSequence, count, 1);
+    if (errors < 0) {
+        return;
+    }
+
+    xil_printf("Sequence: %d steps, %d read-back errors\r\n", (int)count, errors);
+}
+
+/*------------------------------------------------------------------------------
+ * Mode-switch Benchmark - updates/s with and without logging
+ *----------------------------------------------------------------------------*/
+static u32 UpdatesPerSec(u32 iterations, XTime start, XTime end)
+{
+    u64 ticks = (u64)(end - start);
+    u64 rate;
+
+    if (ticks == 0) {
+        return 0;
+    }
+    rate = ((u64)iterations * COUNTS_PER_SECOND) / ticks;
+
+    return (rate > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (u32)rate;
+}
+
+void RunModeBenchmark(void)
+{
+    XTime t0, t1;
+    u32 i;
+    u32 fast_rate, verify_rate, log_rate;
+    int errors = 0;
+
+    /* Fast path: write only */
+    XTime_GetTime(&t0);
+    for (i = 0; i < BENCH_FAST_ITER; i++) {
+        SetModeFast((u8)i);
+    }
+    XTime_GetTime(&t1);
+    fast_rate = UpdatesPerSec(BENCH_FAST_ITER, t0, t1);
+
+    /* Write + read-back */
+    XTime_GetTime(&t0);
+    for (i = 0; i < BENCH_FAST_ITER; i++) {
+        if (SetModeVerified((u8)i) != XST_SUCCESS) {
+            errors++;
+        }
+    }
+    XTime_GetTime(&t1);
+    verify_rate = UpdatesPerSec(BENCH_FAST_ITER, t0, t1);
+
+    /* Logged path (UART bound, fewer iterations) */
+    XTime_GetTime(&t0);
+    for (i = 0; i < BENCH_LOG_ITER; i++) {
+        SetMode((u8)i);
+    }
+    XTime_GetTime(&t1);
+    log_rate = UpdatesPerSec(BENCH_LOG_ITER, t0, t1);
+
+    SetModeFast(MODE_OFF);
+
+    xil_printf("\r\n");
+    xil_printf("------------------------------------------\r\n");
+    xil_printf("  Mode-Switch Rate (updates/s)\r\n");
+    xil_printf("------------------------------------------\r\n");
+    xil_printf("  Fast (no log)      : %u\r\n", fast_rate);
+    xil_printf("  Verified (readback): %u  (%d errors)\r\n", verify_rate, errors);
+    xil_printf("  Logged (SetMode)   : %u\r\n", log_rate);
+    xil_printf("------------------------------------------\r\n");
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * KV260 BRAM Vector Kernel - HLS 소스
+ *
+ * File: bram_vec.cpp
+ * Description: BRAM 포트 B(단일 포트)에서 범위를 읽고 그 자리에 결과를 쓰는
+ *              벡터 연산 (add / scale / min-max / histogram)
+ *
+ * 인터페이스:
+ *   mem                    bram (ram_1p) → blk_mem_gen_0 BRAM_PORTB
+ *   op ~ dst, return       s_axilite (bundle control, ap_ctrl_hs 시작/완료)
+ *
+ * 포트 B는 사이클당 읽기 또는 쓰기 하나이므로 원소당 액세스 수가 II를 정합니다:
+ *   ADD 3 (읽기 2 + 쓰기 1), SCALE 2, MINMAX 1, HIST 2 (로컬 bin 배열 RMW)
+ *
+ * HLS 헤더 없이 표준 C++만 사용하므로 g++로 그대로 C-sim 할 수 있습니다
+ * (pragma는 g++에서 무시됨, bram_vec_tb.cpp).
+ ******************************************************************************/
+
+#include "bram_vec.h"
+
+static int range_ok(uint32_t start, uint32_t words)
+{
+    return start <= BRAM_VEC_WORDS && words <= BRAM_VEC_WORDS - start;
+}
+
+static void vec_add(uint32_t mem[BRAM_VEC_WORDS], uint32_t base, uint32_t src, uint32_t count)
+{
+ADD_LOOP:
+    for (uint32_t i = 0; i < count; i++) {
+#pragma HLS PIPELINE
+#pragma HLS LOOP_TRIPCOUNT min=1 max=2048
+        mem[base + i] = mem[base + i] + mem[src + i];
+    }
+}
+
+static void vec_scale(uint32_t mem[BRAM_VEC_WORDS], uint32_t base, uint32_t count,
+                      int32_t mul, uint32_t shift)
+{
+SCALE_LOOP:
+    for (uint32_t i = 0; i < count; i++) {
+#pragma HLS PIPELINE
+#pragma HLS LOOP_TRIPCOUNT min=1 max=2048
+        int64_t p = (int64_t)(int32_t)mem[base + i] * mul;
+        mem[base + i] = (uint32_t)(int32_t)(p >> shift);
+    }
+}
+
+static void vec_minmax(uint32_t mem[BRAM_VEC_WORDS], uint32_t base, uint32_t count, uint32_t dst)
+{
+    int32_t lo = INT32_MAX;
+    int32_t hi = INT32_MIN;
+
+MINMAX_LOOP:
+    for (uint32_t i = 0; i < count; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=2048
+        int32_t v = (int32_t)mem[base + i];
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+    }
+    mem[dst] = (uint32_t)lo;
+    mem[dst + 1] = (uint32_t)hi;
+}
+
+static void vec_hist(uint32_t mem[BRAM_VEC_WORDS], uint32_t base, uint32_t count,
+                     uint32_t bins, uint32_t shift, uint32_t dst)
+{
+    uint32_t hist[VEC_HIST_MAX_BINS];
+
+HIST_CLEAR:
+    for (uint32_t b = 0; b < bins; b++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=256
+        hist[b] = 0;
+    }
+HIST_LOOP:
+    for (uint32_t i = 0; i < count; i++) {
+#pragma HLS PIPELINE
+#pragma HLS LOOP_TRIPCOUNT min=1 max=2048
+        uint32_t b = mem[base + i] >> shift;
+        if (b >= bins) {
+            b = bins - 1;
+        }
+        hist[b]++;
+    }
+HIST_STORE:
+    for (uint32_t b = 0; b < bins; b++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=256
+        mem[dst + b] = hist[b];
+    }
+}
+
+void bram_vec(uint32_t mem[BRAM_VEC_WORDS], uint32_t op, uint32_t base, uint32_t count,
+              uint32_t arg_a, uint32_t arg_b, uint32_t dst)
+{
+#pragma HLS INTERFACE mode=bram port=mem storage_type=ram_1p
+#pragma HLS INTERFACE mode=s_axilite port=op bundle=control
+#pragma HLS INTERFACE mode=s_axilite port=base bundle=control
+#pragma HLS INTERFACE mode=s_axilite port=count bundle=control
+#pragma HLS INTERFACE mode=s_axilite port=arg_a bundle=control
+#pragma HLS INTERFACE mode=s_axilite port=arg_b bundle=control
+#pragma HLS INTERFACE mode=s_axilite port=dst bundle=control
+#pragma HLS INTERFACE mode=s_axilite port=return bundle=control
+
+    if (!range_ok(base, count)) {
+        return;
+    }
+
+    switch (op) {
+        case VEC_OP_ADD:
+            if (range_ok(arg_a, count)) {
+                vec_add(mem, base, arg_a, count);
+            }
+            break;
+        case VEC_OP_SCALE:
+            vec_scale(mem, base, count, (int32_t)arg_a, arg_b & 31U);
+            break;
+        case VEC_OP_MINMAX:
+            if (range_ok(dst, 2)) {
+                vec_minmax(mem, base, count, dst);
+            }
+            break;
+        case VEC_OP_HIST:
+            if (arg_a >= 1 && arg_a <= VEC_HIST_MAX_BINS && range_ok(dst, arg_a)) {
+                vec_hist(mem, base, count, arg_a, arg_b & 31U, dst);
+            }
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * KV260 BRAM Vector Kernel - HLS 커널 인터페이스
+ *
+ * File: bram_vec.h
+ * Description: BRAM 포트 B에 붙는 in-place 벡터 연산 커널의 연산 코드와
+ *              최상위 함수 선언 (HLS 합성, g++ C-sim, 호스트 모델 공용)
+ *
+ * 모든 오프셋/길이는 BRAM 워드 단위입니다. 범위가 BRAM을 벗어나면 아무것도
+ * 하지 않고 끝납니다 (앱이 미리 검사).
+ *
+ *   VEC_OP_ADD     mem[base + i] += mem[arg_a + i]             (i < count)
+ *   VEC_OP_SCALE   mem[base + i] = (s32)mem[base + i] * (s32)arg_a >> arg_b
+ *                  (64비트 곱 후 산술 시프트, Q 포맷 고정소수점 배율)
+ *   VEC_OP_MINMAX  mem[dst] = 최소, mem[dst + 1] = 최대 (부호 있는 비교)
+ *   VEC_OP_HIST    bin = mem[base + i] >> arg_b, arg_a - 1 에서 포화
+ *                  mem[dst .. dst + arg_a - 1] = bin별 개수 (arg_a = 1..256)
+ ******************************************************************************/
+
+#ifndef BRAM_VEC_H
+#define BRAM_VEC_H
+
+#include <stdint.h>
+
+#define BRAM_VEC_WORDS      2048        /* 8KB BRAM */
+#define VEC_HIST_MAX_BINS   256
+
+#define VEC_OP_ADD          0
+#define VEC_OP_SCALE        1
+#define VEC_OP_MINMAX       2
+#define VEC_OP_HIST         3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void bram_vec(uint32_t mem[BRAM_VEC_WORDS], uint32_t op, uint32_t base, uint32_t count,
+              uint32_t arg_a, uint32_t arg_b, uint32_t dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BRAM_VEC_H */
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * KV260 BRAM Vector Kernel - C-simulation 테스트벤치
+ *
+ * File: bram_vec_tb.cpp
+ * Description: 연산별 참조 구현과 커널 결과를 BRAM 전체 이미지로 비교
+ *              (결과 범위는 일치, 범위 밖 워드는 그대로인지 함께 확인)
+ *
+ * Vitis HLS csim_design 또는 g++ 단독으로 실행합니다 (0 = PASS):
+ *   g++ -O2 -Wall -Wno-unknown-pragmas -Wno-unused-label -o bram_vec_csim bram_vec.cpp bram_vec_tb.cpp
+ *   ./bram_vec_csim
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "bram_vec.h"
+
+static uint32_t mem[BRAM_VEC_WORDS];
+static uint32_t ref[BRAM_VEC_WORDS];
+static uint32_t rng = 1;
+static int failures;
+
+static uint32_t next_rand(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void fill_random(void)
+{
+    for (int i = 0; i < BRAM_VEC_WORDS; i++) {
+        mem[i] = next_rand();
+    }
+    memcpy(ref, mem, sizeof(mem));
+}
+
+/*******************************************************************************
+ * 참조 구현 (커널과 독립적으로 작성)
+ ******************************************************************************/
+static int in_bram(uint32_t start, uint32_t words)
+{
+    return (uint64_t)start + words <= BRAM_VEC_WORDS;
+}
+
+static void ref_op(uint32_t op, uint32_t base, uint32_t count,
+                   uint32_t a, uint32_t b, uint32_t dst)
+{
+    if (!in_bram(base, count)) {
+        return;
+    }
+    if (op == VEC_OP_ADD && in_bram(a, count)) {
+        for (uint32_t i = 0; i < count; i++) {
+            ref[base + i] += ref[a + i];
+        }
+    } else if (op == VEC_OP_SCALE) {
+        for (uint32_t i = 0; i < count; i++) {
+            int64_t p = (int64_t)(int32_t)ref[base + i] * (int64_t)(int32_t)a;
+            ref[base + i] = (uint32_t)(int32_t)(p >> (b & 31U));
+        }
+    } else if (op == VEC_OP_MINMAX && in_bram(dst, 2)) {
+        int32_t lo = INT32_MAX, hi = INT32_MIN;
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t v = (int32_t)ref[base + i];
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+        }
+        ref[dst] = (uint32_t)lo;
+        ref[dst + 1] = (uint32_t)hi;
+    } else if (op == VEC_OP_HIST && a >= 1 && a <= VEC_HIST_MAX_BINS && in_bram(dst, a)) {
+        uint32_t h[VEC_HIST_MAX_BINS] = {0};
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t bin = ref[base + i] >> (b & 31U);
+            h[bin < a ? bin : a - 1]++;
+        }
+        for (uint32_t k = 0; k < a; k++) {
+            ref[dst + k] = h[k];
+        }
+    }
+}
+
+/*******************************************************************************
+ * 케이스 실행
+ ******************************************************************************/
+static void run_case(const char *name, uint32_t op, uint32_t base, uint32_t count,
+                     uint32_t a, uint32_t b, uint32_t dst)
+{
+    int bad = 0, first = -1;
+
+    ref_op(op, base, count, a, b, dst);
+    bram_vec(mem, op, base, count, a, b, dst);
+
+    for (int i = 0; i < BRAM_VEC_WORDS; i++) {
+        if (mem[i] != ref[i]) {
+            if (first < 0) {
+                first = i;
+            }
+            bad++;
+        }
+    }
+    if (bad == 0) {
+        printf("  %-44s PASS\n", name);
+    } else {
+        printf("  %-44s FAIL (%d words, first @%d: 0x%08X != 0x%08X)\n",
+               name, bad, first, mem[first], ref[first]);
+        failures++;
+    }
+}
+
+int main(void)
+{
+    printf("bram_vec C-simulation\n");
+
+    /* ADD */
+    fill_random();
+    run_case("add 1024 words (disjoint ranges)", VEC_OP_ADD, 0, 1024, 1024, 0, 0);
+    fill_random();
+    run_case("add overlapping src = base + 1", VEC_OP_ADD, 100, 500, 101, 0, 0);
+    fill_random();
+    run_case("add whole BRAM onto itself (x2)", VEC_OP_ADD, 0, BRAM_VEC_WORDS, 0, 0, 0);
+
+    /* SCALE */
+    fill_random();
+    run_case("scale x3 (shift 0)", VEC_OP_SCALE, 0, 2048, 3, 0, 0);
+    fill_random();
+    run_case("scale Q16 x0.75 (0xC000 >> 16)", VEC_OP_SCALE, 512, 700, 0xC000, 16, 0);
+    fill_random();
+    run_case("scale negative x-5 >> 1", VEC_OP_SCALE, 7, 33, (uint32_t)-5, 1, 0);
+
+    /* MINMAX */
+    fill_random();
+    run_case("min-max 2046 words -> 2046", VEC_OP_MINMAX, 0, 2046, 0, 0, 2046);
+    fill_random();
+    mem[300] = ref[300] = 0x80000000U;      /* INT32_MIN */
+    mem[301] = ref[301] = 0x7FFFFFFFU;      /* INT32_MAX */
+    run_case("min-max with INT32_MIN/MAX present", VEC_OP_MINMAX, 256, 128, 0, 0, 0);
+    fill_random();
+    run_case("min-max count 0 (identity values)", VEC_OP_MINMAX, 10, 0, 0, 0, 20);
+
+    /* HIST */
+    fill_random();
+    run_case("hist 16 bins of top 4 bits", VEC_OP_HIST, 0, 1792, 16, 28, 1792);
+    fill_random();
+    run_case("hist 256 bins, shift 20 (upper clamp)", VEC_OP_HIST, 0, 1024, 256, 20, 1024);
+    fill_random();
+    run_case("hist 1 bin (count only)", VEC_OP_HIST, 5, 77, 1, 0, 2000);
+    fill_random();
+    run_case("hist output over its own input", VEC_OP_HIST, 0, 512, 64, 26, 0);
+
+    /* 범위 밖 / 잘못된 인자 → BRAM 변경 없음 */
+    fill_random();
+    run_case("add past end of BRAM (no-op)", VEC_OP_ADD, 2000, 100, 0, 0, 0);
+    fill_random();
+    run_case("add src past end (no-op)", VEC_OP_ADD, 0, 100, 2000, 0, 0);
+    fill_random();
+    run_case("min-max dst at last word (no-op)", VEC_OP_MINMAX, 0, 100, 0, 0, 2047);
+    fill_random();
+    run_case("hist 0 bins (no-op)", VEC_OP_HIST, 0, 100, 0, 0, 200);
+    fill_random();
+    run_case("hist 257 bins (no-op)", VEC_OP_HIST, 0, 100, 257, 0, 200);
+    fill_random();
+    run_case("unknown op (no-op)", 7, 0, 100, 0, 0, 0);
+
+    printf("bram_vec C-simulation: %s (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
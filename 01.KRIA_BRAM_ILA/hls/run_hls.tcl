@@ -0,0 +1,41 @@
+#==============================================================================
+# KV260 BRAM Vector Kernel - Vitis HLS TCL Script
+# Vitis HLS Version: 2022.2
+# Description: C-sim → 합성 → IP 카탈로그 export (create_project.tcl -kernel 1 이 사용)
+#
+# 사용법 (hls/ 에서):
+#   vitis_hls -f run_hls.tcl                    # csim + csynth + export
+#   vitis_hls -f run_hls.tcl -tclargs -csim     # C-sim만
+# 결과 IP: bram_vec_prj/solution1/impl/ip (xilinx.com:hls:bram_vec:1.0)
+#==============================================================================
+
+set hls_dir      [file dirname [info script]]
+set part_number  "xck26-sfvc784-2LV-c"
+
+# 합성 목표 클럭 (ns) - 빌드할 PL 클럭 이상으로 맞춤 (기본 300 MHz까지 커버)
+if {![info exists hls_clk_ns]} {
+    set hls_clk_ns 3.3
+}
+set csim_only [expr {[lsearch -exact [expr {[info exists argv] ? $argv : {}}] "-csim"] >= 0}]
+
+open_project -reset $hls_dir/bram_vec_prj
+set_top bram_vec
+add_files $hls_dir/bram_vec.cpp
+add_files -tb $hls_dir/bram_vec_tb.cpp
+
+open_solution -reset solution1 -flow_target vivado
+set_part $part_number
+create_clock -period $hls_clk_ns -name default
+
+puts "Running C simulation..."
+csim_design
+
+if {!$csim_only} {
+    puts "Running C synthesis..."
+    csynth_design
+
+    puts "Exporting IP..."
+    export_design -format ip_catalog -vendor xilinx.com -library hls -version 1.0
+}
+
+exit
@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Userspace Access - BRAM 매핑
+ *
+ * File: bram_map.c
+ * Description: PL BRAM(0x80000000, 8KB)을 유저 공간에 mmap으로 매핑
+ *              (UIO, /dev/mem, 또는 호스트 테스트용 anonymous/file 매핑)
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bram_map.h"
+
+/**
+ * @brief sysfs 파일에서 한 줄 읽기
+ */
+static int read_sysfs(const char *path, char *buf, size_t len)
+{
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        return -1;
+    }
+    if (fgets(buf, (int)len, f) == NULL) {
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+    buf[strcspn(buf, "\n")] = '\0';
+    return 0;
+}
+
+/**
+ * @brief 이름으로 UIO 디바이스 검색 (/sys/class/uio/uioN/name)
+ * @return uio 번호, 없으면 -1
+ */
+static int find_uio_by_name(const char *name)
+{
+    DIR *dir;
+    struct dirent *ent;
+    char path[320];
+    char dev_name[64];
+    int found = -1;
+
+    dir = opendir("/sys/class/uio");
+    if (dir == NULL) {
+        return -1;
+    }
+    while ((ent = readdir(dir)) != NULL) {
+        if (strncmp(ent->d_name, "uio", 3) != 0) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "/sys/class/uio/%s/name", ent->d_name);
+        if (read_sysfs(path, dev_name, sizeof(dev_name)) == 0 &&
+            strstr(dev_name, name) != NULL) {
+            found = atoi(ent->d_name + 3);
+            break;
+        }
+    }
+    closedir(dir);
+    return found;
+}
+
+static int open_uio(bram_map_t *m, const char *arg)
+{
+    char path[256];
+    char buf[64];
+    int num;
+
+    if (strncmp(arg, "/dev/", 5) == 0) {
+        snprintf(m->path, sizeof(m->path), "%s", arg);
+        num = atoi(arg + strlen("/dev/uio"));
+    } else {
+        num = find_uio_by_name(arg);
+        if (num < 0) {
+            fprintf(stderr, "ERROR: no UIO device named '%s'\n", arg);
+            return -1;
+        }
+        snprintf(m->path, sizeof(m->path), "/dev/uio%d", num);
+    }
+
+    /* map0 크기 (없으면 8KB로 가정) */
+    m->map_len = BRAM_SIZE_BYTES;
+    snprintf(path, sizeof(path), "/sys/class/uio/uio%d/maps/map0/size", num);
+    if (read_sysfs(path, buf, sizeof(buf)) == 0) {
+        m->map_len = (size_t)strtoul(buf, NULL, 0);
+    }
+    snprintf(path, sizeof(path), "/sys/class/uio/uio%d/maps/map0/addr", num);
+    if (read_sysfs(path, buf, sizeof(buf)) == 0) {
+        m->phys = strtoull(buf, NULL, 0);
+    }
+
+    m->fd = open(m->path, O_RDWR | O_SYNC);
+    if (m->fd < 0) {
+        fprintf(stderr, "ERROR: open %s: %s\n", m->path, strerror(errno));
+        return -1;
+    }
+    /* UIO는 mmap offset = map 번호 x 페이지 크기 */
+    m->map_addr = mmap(NULL, m->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, m->fd, 0);
+    if (m->map_addr == MAP_FAILED) {
+        fprintf(stderr, "ERROR: mmap %s: %s\n", m->path, strerror(errno));
+        return -1;
+    }
+    m->base = (volatile uint32_t *)m->map_addr;
+    return 0;
+}
+
+static int open_devmem(bram_map_t *m, const char *arg)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    uint64_t page_base;
+    size_t page_off;
+
+    m->phys = (arg != NULL && *arg != '\0') ? strtoull(arg, NULL, 0) : BRAM_PHYS_ADDR;
+    snprintf(m->path, sizeof(m->path), "/dev/mem");
+
+    m->fd = open("/dev/mem", O_RDWR | O_SYNC);
+    if (m->fd < 0) {
+        fprintf(stderr, "ERROR: open /dev/mem: %s (root required)\n", strerror(errno));
+        return -1;
+    }
+
+    page_base = m->phys & ~((uint64_t)page - 1);
+    page_off = (size_t)(m->phys - page_base);
+    m->map_len = page_off + m->size;
+    m->map_addr = mmap(NULL, m->map_len, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       m->fd, (off_t)page_base);
+    if (m->map_addr == MAP_FAILED) {
+        fprintf(stderr, "ERROR: mmap /dev/mem @0x%llx: %s\n",
+                (unsigned long long)page_base, strerror(errno));
+        return -1;
+    }
+    m->base = (volatile uint32_t *)((uint8_t *)m->map_addr + page_off);
+    return 0;
+}
+
+static int open_anon(bram_map_t *m)
+{
+    m->phys = BRAM_PHYS_ADDR;
+    snprintf(m->path, sizeof(m->path), "anonymous");
+    m->map_len = m->size;
+    m->map_addr = mmap(NULL, m->map_len, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (m->map_addr == MAP_FAILED) {
+        fprintf(stderr, "ERROR: anonymous mmap: %s\n", strerror(errno));
+        return -1;
+    }
+    m->base = (volatile uint32_t *)m->map_addr;
+    return 0;
+}
+
+static int open_file(bram_map_t *m, const char *arg)
+{
+    struct stat st;
+
+    m->phys = BRAM_PHYS_ADDR;
+    snprintf(m->path, sizeof(m->path), "%s", arg);
+
+    m->fd = open(arg, O_RDWR | O_CREAT, 0644);
+    if (m->fd < 0) {
+        fprintf(stderr, "ERROR: open %s: %s\n", arg, strerror(errno));
+        return -1;
+    }
+    if (fstat(m->fd, &st) == 0 && (size_t)st.st_size < m->size) {
+        if (ftruncate(m->fd, (off_t)m->size) != 0) {
+            fprintf(stderr, "ERROR: ftruncate %s: %s\n", arg, strerror(errno));
+            return -1;
+        }
+    }
+    m->map_len = m->size;
+    m->map_addr = mmap(NULL, m->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, m->fd, 0);
+    if (m->map_addr == MAP_FAILED) {
+        fprintf(stderr, "ERROR: mmap %s: %s\n", arg, strerror(errno));
+        return -1;
+    }
+    m->base = (volatile uint32_t *)m->map_addr;
+    return 0;
+}
+
+/**
+ * @brief spec 문자열에 따라 BRAM 매핑 열기
+ * @return 0 성공, -1 실패
+ */
+int bram_map_open(bram_map_t *m, const char *spec)
+{
+    const char *arg;
+    int ret;
+
+    memset(m, 0, sizeof(*m));
+    m->fd = -1;
+    m->size = BRAM_SIZE_BYTES;
+    m->map_addr = MAP_FAILED;
+
+    if (spec == NULL || *spec == '\0') {
+        spec = getenv("BRAM_DEV");
+    }
+    if (spec == NULL || *spec == '\0') {
+        spec = BRAM_MAP_DEFAULT;
+    }
+
+    arg = strchr(spec, ':');
+    arg = (arg != NULL) ? arg + 1 : "";
+
+    if (strncmp(spec, "uio", 3) == 0) {
+        m->kind = BRAM_MAP_UIO;
+        ret = open_uio(m, *arg ? arg : "axi_bram");
+    } else if (strncmp(spec, "devmem", 6) == 0) {
+        m->kind = BRAM_MAP_DEVMEM;
+        ret = open_devmem(m, arg);
+    } else if (strcmp(spec, "anon") == 0) {
+        m->kind = BRAM_MAP_ANON;
+        ret = open_anon(m);
+    } else if (strncmp(spec, "file:", 5) == 0) {
+        m->kind = BRAM_MAP_FILE;
+        ret = open_file(m, arg);
+    } else {
+        fprintf(stderr, "ERROR: unknown device spec '%s'\n", spec);
+        return -1;
+    }
+
+    if (ret != 0) {
+        bram_map_close(m);
+        return -1;
+    }
+    if (m->map_len < m->size) {
+        m->size = m->map_len;
+    }
+    return 0;
+}
+
+/**
+ * @brief 매핑 해제
+ */
+void bram_map_close(bram_map_t *m)
+{
+    if (m->map_addr != MAP_FAILED && m->map_addr != NULL) {
+        munmap(m->map_addr, m->map_len);
+    }
+    if (m->fd >= 0) {
+        close(m->fd);
+    }
+    m->map_addr = MAP_FAILED;
+    m->base = NULL;
+    m->fd = -1;
+}
+
+const char *bram_map_kind_name(const bram_map_t *m)
+{
+    switch (m->kind) {
+        case BRAM_MAP_UIO:    return "uio";
+        case BRAM_MAP_DEVMEM: return "devmem";
+        case BRAM_MAP_ANON:   return "anon";
+        case BRAM_MAP_FILE:   return "file";
+    }
+    return "?";
+}
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Userspace Access - BRAM 매핑
+ *
+ * File: bram_map.h
+ * Description: PL BRAM(0x80000000, 8KB)을 유저 공간에 mmap으로 매핑
+ *              (UIO, /dev/mem, 또는 호스트 테스트용 anonymous/file 매핑)
+ ******************************************************************************/
+
+#ifndef BRAM_MAP_H
+#define BRAM_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BRAM_PHYS_ADDR      0x80000000UL
+#define BRAM_SIZE_BYTES     (8 * 1024)
+#define BRAM_SIZE_WORDS     (BRAM_SIZE_BYTES / 4)
+#define BRAM_MAX_OFFSET     (BRAM_SIZE_WORDS - 1)
+
+/* 기본 디바이스 지정 (환경변수 BRAM_DEV로 변경 가능) */
+#define BRAM_MAP_DEFAULT    "uio:axi_bram"
+
+typedef enum {
+    BRAM_MAP_UIO,       /* /dev/uioN (generic-uio)               */
+    BRAM_MAP_DEVMEM,    /* /dev/mem, O_SYNC (uncached)           */
+    BRAM_MAP_ANON,      /* anonymous mmap (호스트 테스트용)      */
+    BRAM_MAP_FILE       /* 파일 기반 mmap (호스트 테스트, 영속)  */
+} bram_map_kind_t;
+
+typedef struct {
+    bram_map_kind_t     kind;
+    int                 fd;
+    volatile uint32_t  *base;       /* 매핑된 BRAM 시작 주소 */
+    size_t              size;       /* BRAM 크기 (bytes) */
+    void               *map_addr;   /* munmap 용 (페이지 정렬) */
+    size_t              map_len;
+    uint64_t            phys;       /* 물리 주소 (패턴/출력용) */
+    char                path[128];
+} bram_map_t;
+
+/*
+ * spec 형식:
+ *   uio:/dev/uio0      UIO 디바이스 직접 지정
+ *   uio:<name>         /sys/class/uio/uioN/name 에 <name>이 포함된 디바이스
+ *   devmem[:<addr>]    /dev/mem (기본 0x80000000)
+ *   anon               anonymous 공유 매핑
+ *   file:<path>        파일 기반 매핑 (없으면 생성)
+ */
+int bram_map_open(bram_map_t *m, const char *spec);
+void bram_map_close(bram_map_t *m);
+const char *bram_map_kind_name(const bram_map_t *m);
+
+/* 워드 단위 액세스 (디바이스 메모리이므로 memcpy 대신 사용) */
+static inline void bram_wr32(const bram_map_t *m, uint32_t offset, uint32_t data)
+{
+    m->base[offset] = data;
+}
+
+static inline uint32_t bram_rd32(const bram_map_t *m, uint32_t offset)
+{
+    return m->base[offset];
+}
+
+#endif /* BRAM_MAP_H */
@@ -0,0 +1,325 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Multi-threaded Benchmark
+ *
+ * File: bram_mt_bench.c
+ * Description: 1~N개의 CPU 고정(sched_setaffinity) 스레드가 매핑된 BRAM을
+ *              분할하여 read/write/copy 커널을 8/16/32/64비트 폭으로 실행하고
+ *              스레드 수별 처리량(GB/s)과 pass별 평균 액세스 시간의
+ *              백분위(p50/p90/p99, 단일 액세스 지연이 아님)를 출력
+ *
+ * 액세스 패턴은 main.c bram_read_multiple/bram_write_multiple과 같은
+ * 연속 오프셋 루프이며, 폭만 달라집니다.
+ *
+ * Usage: bram_mt_bench [-d <spec>] [-t <max threads>] [-p <passes>]
+ *                      [-c <first cpu>] [-w <8,16,32,64>] [-o]
+ *   -o: 스레드 수가 first cpu 이후 CPU 수보다 많을 때 CPU 공유를 허용
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bram_map.h"
+
+#define MAX_THREADS         4
+#define DEFAULT_PASSES      200
+
+typedef enum {
+    KERNEL_READ,
+    KERNEL_WRITE,
+    KERNEL_COPY,
+    KERNEL_COUNT
+} kernel_t;
+
+static const char *kernel_names[KERNEL_COUNT] = { "read", "write", "copy" };
+
+typedef struct {
+    int                 id;
+    int                 cpu;
+    kernel_t            kernel;
+    unsigned            width;      /* bits */
+    volatile uint8_t   *slice;
+    size_t              slice_bytes;
+    unsigned            passes;
+    uint64_t           *samples;    /* pass당 ns */
+    uint64_t            t_start;
+    uint64_t            t_end;
+    uint64_t            sink;
+    int                 pinned;
+} worker_t;
+
+static bram_map_t bram;
+static pthread_barrier_t barrier;
+
+/*******************************************************************************
+ * 유틸리티
+ ******************************************************************************/
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*******************************************************************************
+ * 커널 (폭별 연속 액세스)
+ ******************************************************************************/
+#define DEFINE_KERNELS(bits)                                                    \
+static uint64_t read_##bits(volatile uint8_t *p, size_t bytes)                  \
+{                                                                               \
+    volatile uint##bits##_t *q = (volatile uint##bits##_t *)p;                  \
+    size_t i, n = bytes / sizeof(uint##bits##_t);                               \
+    uint64_t sum = 0;                                                           \
+    for (i = 0; i < n; i++) {                                                   \
+        sum += q[i];                                                            \
+    }                                                                           \
+    return sum;                                                                 \
+}                                                                               \
+static void write_##bits(volatile uint8_t *p, size_t bytes, uint64_t seed)      \
+{                                                                               \
+    volatile uint##bits##_t *q = (volatile uint##bits##_t *)p;                  \
+    size_t i, n = bytes / sizeof(uint##bits##_t);                               \
+    for (i = 0; i < n; i++) {                                                   \
+        q[i] = (uint##bits##_t)(seed + i);                                      \
+    }                                                                           \
+}                                                                               \
+static void copy_##bits(volatile uint8_t *dst, volatile uint8_t *src,           \
+                        size_t bytes)                                           \
+{                                                                               \
+    volatile uint##bits##_t *d = (volatile uint##bits##_t *)dst;                \
+    volatile uint##bits##_t *s = (volatile uint##bits##_t *)src;                \
+    size_t i, n = bytes / sizeof(uint##bits##_t);                               \
+    for (i = 0; i < n; i++) {                                                   \
+        d[i] = s[i];                                                            \
+    }                                                                           \
+}
+
+DEFINE_KERNELS(8)
+DEFINE_KERNELS(16)
+DEFINE_KERNELS(32)
+DEFINE_KERNELS(64)
+
+/**
+ * @brief 한 pass 실행 (slice 전체를 1회 처리)
+ * @return 처리한 바이트 수 (copy는 절반 읽기 + 절반 쓰기)
+ */
+static size_t run_pass(worker_t *w, unsigned pass)
+{
+    volatile uint8_t *p = w->slice;
+    size_t n = w->slice_bytes;
+    size_t half = n / 2;
+
+    switch (w->kernel) {
+        case KERNEL_READ:
+            switch (w->width) {
+                case 8:  w->sink += read_8(p, n);  break;
+                case 16: w->sink += read_16(p, n); break;
+                case 32: w->sink += read_32(p, n); break;
+                default: w->sink += read_64(p, n); break;
+            }
+            return n;
+        case KERNEL_WRITE:
+            switch (w->width) {
+                case 8:  write_8(p, n, pass);  break;
+                case 16: write_16(p, n, pass); break;
+                case 32: write_32(p, n, pass); break;
+                default: write_64(p, n, pass); break;
+            }
+            return n;
+        default:
+            switch (w->width) {
+                case 8:  copy_8(p + half, p, half);  break;
+                case 16: copy_16(p + half, p, half); break;
+                case 32: copy_32(p + half, p, half); break;
+                default: copy_64(p + half, p, half); break;
+            }
+            return n;
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    cpu_set_t set;
+    unsigned i;
+    uint64_t t0;
+
+    CPU_ZERO(&set);
+    CPU_SET(w->cpu, &set);
+    w->pinned = (sched_setaffinity(0, sizeof(set), &set) == 0);
+
+    /* 워밍업 1 pass 후 동시에 시작 */
+    run_pass(w, 0);
+    pthread_barrier_wait(&barrier);
+
+    w->t_start = now_ns();
+    for (i = 0; i < w->passes; i++) {
+        t0 = now_ns();
+        run_pass(w, i);
+        w->samples[i] = now_ns() - t0;
+    }
+    w->t_end = now_ns();
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * 측정
+ ******************************************************************************/
+static void run_config(int nthreads, kernel_t kernel, unsigned width,
+                       unsigned passes, int first_cpu, int ncpu)
+{
+    pthread_t tid[MAX_THREADS];
+    worker_t w[MAX_THREADS];
+    size_t slice = (bram.size / nthreads) & ~(size_t)15;
+    uint64_t t_min = UINT64_MAX, t_max = 0;
+    uint64_t *all;
+    size_t total_bytes = 0, nsamples = 0;
+    size_t words_per_pass = slice / (width / 8);
+    double gbps, p50, p90, p99;
+    int i, pinned = 1;
+
+    all = calloc((size_t)nthreads * passes, sizeof(uint64_t));
+    pthread_barrier_init(&barrier, NULL, (unsigned)nthreads);
+
+    for (i = 0; i < nthreads; i++) {
+        memset(&w[i], 0, sizeof(w[i]));
+        w[i].id = i;
+        w[i].cpu = (first_cpu + i) % ncpu;
+        w[i].kernel = kernel;
+        w[i].width = width;
+        w[i].slice = (volatile uint8_t *)bram.base + (size_t)i * slice;
+        w[i].slice_bytes = slice;
+        w[i].passes = passes;
+        w[i].samples = all + (size_t)i * passes;
+        pthread_create(&tid[i], NULL, worker_main, &w[i]);
+    }
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(tid[i], NULL);
+        if (w[i].t_start < t_min) t_min = w[i].t_start;
+        if (w[i].t_end > t_max) t_max = w[i].t_end;
+        total_bytes += slice * passes;
+        nsamples += passes;
+        pinned &= w[i].pinned;
+    }
+    pthread_barrier_destroy(&barrier);
+
+    /* pass 시간 / pass당 액세스 수 = pass별 평균 액세스 시간 (ns), pass 간 백분위 */
+    qsort(all, nsamples, sizeof(uint64_t), cmp_u64);
+    p50 = (double)all[nsamples * 50 / 100] / words_per_pass;
+    p90 = (double)all[nsamples * 90 / 100] / words_per_pass;
+    p99 = (double)all[nsamples * 99 / 100] / words_per_pass;
+    gbps = (double)total_bytes / (double)(t_max - t_min);
+
+    printf("%7d  %-6s %5u  %9.3f  %8.2f  %8.2f  %8.2f  %s%s\n",
+           nthreads, kernel_names[kernel], width, gbps, p50, p90, p99,
+           pinned ? "" : "(not pinned) ",
+           first_cpu + nthreads > ncpu ? "(shared CPU)" : "");
+    free(all);
+}
+
+/*******************************************************************************
+ * 메인
+ ******************************************************************************/
+static void usage(const char *prog)
+{
+    printf("Usage: %s [-d <spec>] [-t <max threads>] [-p <passes>]\n", prog);
+    printf("       %*s [-c <first cpu>] [-w <widths, e.g. 8,16,32,64>] [-o]\n",
+           (int)strlen(prog), "");
+    printf("  -o: allow more threads than CPUs from <first cpu> (threads share CPUs)\n");
+    printf("  spec: uio:<name> | devmem[:addr] | anon | file:<path>\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *spec = NULL;
+    int max_threads = MAX_THREADS;
+    unsigned passes = DEFAULT_PASSES;
+    int first_cpu = 0;
+    unsigned widths[4] = { 8, 16, 32, 64 };
+    int nwidths = 4;
+    int ncpu = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int oversubscribe = 0;
+    int opt, t, k, wi;
+
+    while ((opt = getopt(argc, argv, "d:t:p:c:w:oh")) != -1) {
+        switch (opt) {
+            case 'd': spec = optarg; break;
+            case 't': max_threads = atoi(optarg); break;
+            case 'p': passes = (unsigned)atoi(optarg); break;
+            case 'c': first_cpu = atoi(optarg); break;
+            case 'o': oversubscribe = 1; break;
+            case 'w': {
+                char *tok = strtok(optarg, ",");
+                nwidths = 0;
+                while (tok != NULL && nwidths < 4) {
+                    unsigned v = (unsigned)atoi(tok);
+                    if (v == 8 || v == 16 || v == 32 || v == 64) {
+                        widths[nwidths++] = v;
+                    }
+                    tok = strtok(NULL, ",");
+                }
+                break;
+            }
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > MAX_THREADS) max_threads = MAX_THREADS;
+    if (passes < 1) passes = 1;
+    if (nwidths == 0 || ncpu < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (first_cpu < 0 || first_cpu >= ncpu) {
+        fprintf(stderr, "ERROR: first CPU %d is not online (0..%d)\n", first_cpu, ncpu - 1);
+        return 1;
+    }
+    if (first_cpu + max_threads > ncpu) {
+        if (!oversubscribe) {
+            fprintf(stderr, "ERROR: %d threads from CPU %d need %d CPUs, only %d online.\n"
+                    "       Lower -t / -c, or pass -o to let threads share CPUs.\n",
+                    max_threads, first_cpu, first_cpu + max_threads, ncpu);
+            return 1;
+        }
+        fprintf(stderr, "WARNING: threads beyond CPU %d wrap around and share CPUs; "
+                "those rows are marked (shared CPU)\n", ncpu - 1);
+    }
+
+    if (bram_map_open(&bram, spec) != 0) {
+        return 2;
+    }
+
+    printf("BRAM multi-threaded benchmark\n");
+    printf("  Backend: %s (%s), %zu bytes\n", bram_map_kind_name(&bram), bram.path, bram.size);
+    printf("  CPUs online: %d, first CPU: %d, passes: %u\n", ncpu, first_cpu, passes);
+    printf("  ns/acc = pass time / accesses per pass (mean per pass, percentiles over passes;\n");
+    printf("           not single-access latency)\n\n");
+    printf("Threads  Kernel Width     GB/s  ns/acc50  ns/acc90  ns/acc99\n");
+    printf("-------  ------ -----  -------  --------  --------  --------\n");
+
+    for (t = 1; t <= max_threads; t++) {
+        for (k = 0; k < KERNEL_COUNT; k++) {
+            for (wi = 0; wi < nwidths; wi++) {
+                run_config(t, (kernel_t)k, widths[wi], passes, first_cpu, ncpu);
+            }
+        }
+    }
+
+    bram_map_close(&bram);
+    return 0;
+}
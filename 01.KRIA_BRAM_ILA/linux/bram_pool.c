@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Userspace Access - 고정 블록 풀
+ *
+ * File: bram_pool.c
+ * Description: 매핑된 BRAM 창 위의 고정 크기 블록 할당기 (lock-free)
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "bram_pool.h"
+
+#define IDX_NONE            0xFFFFu
+#define HEAD_IDX(h)         ((uint16_t)((h) & 0xFFFFu))
+#define HEAD_TAG(h)         ((h) >> 16)
+#define HEAD_MAKE(tag, idx) (((tag) << 16) | (uint64_t)(idx))
+
+static inline bram_handle_t make_handle(uint16_t gen, uint32_t idx)
+{
+    return ((uint32_t)gen << 16) | idx;
+}
+
+/*******************************************************************************
+ * free list (Treiber 스택)
+ *
+ * 헤드에 ABA 태그를 함께 두어, pop 도중 같은 블록이 해제-재할당되어
+ * 헤드 인덱스가 같아지더라도 CAS가 실패하도록 합니다.
+ ******************************************************************************/
+static void push_free(bram_pool_t *p, uint16_t idx)
+{
+    uint64_t old = atomic_load_explicit(&p->head, memory_order_relaxed);
+    uint64_t new;
+
+    do {
+        atomic_store_explicit(&p->next[idx], HEAD_IDX(old), memory_order_relaxed);
+        new = HEAD_MAKE(HEAD_TAG(old) + 1, idx);
+    } while (!atomic_compare_exchange_weak_explicit(&p->head, &old, new,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+static uint16_t pop_free(bram_pool_t *p)
+{
+    uint64_t old = atomic_load_explicit(&p->head, memory_order_acquire);
+    uint64_t new;
+    uint16_t idx;
+
+    do {
+        idx = HEAD_IDX(old);
+        if (idx == IDX_NONE) {
+            return IDX_NONE;
+        }
+        new = HEAD_MAKE(HEAD_TAG(old) + 1,
+                        atomic_load_explicit(&p->next[idx], memory_order_relaxed));
+    } while (!atomic_compare_exchange_weak_explicit(&p->head, &old, new,
+                                                    memory_order_acquire,
+                                                    memory_order_acquire));
+    return idx;
+}
+
+/*******************************************************************************
+ * 풀
+ ******************************************************************************/
+int bram_pool_init(bram_pool_t *p, const bram_map_t *map,
+                   uint32_t offset, uint32_t bytes, uint32_t block_size)
+{
+    uint32_t i, count;
+
+    if (block_size < BRAM_POOL_MIN_BLOCK || (block_size & (block_size - 1)) != 0) {
+        fprintf(stderr, "ERROR: pool block size %u must be a power of two >= %u\n",
+                block_size, BRAM_POOL_MIN_BLOCK);
+        return -1;
+    }
+    if ((offset & 3) != 0 || offset >= map->size || bytes > map->size - offset) {
+        fprintf(stderr, "ERROR: pool range 0x%X+0x%X outside BRAM (0x%zX)\n",
+                offset, bytes, map->size);
+        return -1;
+    }
+    count = bytes / block_size;
+    if (count == 0 || count > BRAM_POOL_MAX_BLOCKS) {
+        fprintf(stderr, "ERROR: pool needs 1..%u blocks (got %u)\n",
+                BRAM_POOL_MAX_BLOCKS, count);
+        return -1;
+    }
+
+    p->map = map;
+    p->offset = offset;
+    p->block_size = block_size;
+    p->block_words = block_size / 4;
+    p->count = count;
+    atomic_init(&p->in_use, 0);
+    atomic_init(&p->high_water, 0);
+    atomic_init(&p->alloc_fail, 0);
+    atomic_init(&p->owner_fault, 0);
+
+    /* 0번 블록이 먼저 나오도록 역순으로 연결 */
+    for (i = 0; i < count; i++) {
+        atomic_init(&p->next[i], (uint16_t)(i + 1 < count ? i + 1 : IDX_NONE));
+        atomic_init(&p->gen[i], 1);
+        atomic_init(&p->owner[i], BRAM_POOL_OWNER_FREE);
+    }
+    atomic_init(&p->head, HEAD_MAKE(0, 0));
+    return 0;
+}
+
+bram_handle_t bram_pool_alloc(bram_pool_t *p, uint32_t owner)
+{
+    uint16_t idx;
+    uint32_t used, hw;
+
+    if (owner == BRAM_POOL_OWNER_FREE) {
+        return BRAM_HANDLE_NONE;
+    }
+    idx = pop_free(p);
+    if (idx == IDX_NONE) {
+        atomic_fetch_add_explicit(&p->alloc_fail, 1, memory_order_relaxed);
+        return BRAM_HANDLE_NONE;
+    }
+    atomic_store_explicit(&p->owner[idx], owner, memory_order_relaxed);
+
+    used = atomic_fetch_add_explicit(&p->in_use, 1, memory_order_relaxed) + 1;
+    hw = atomic_load_explicit(&p->high_water, memory_order_relaxed);
+    while (used > hw &&
+           !atomic_compare_exchange_weak_explicit(&p->high_water, &hw, used,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+    }
+
+    return make_handle(atomic_load_explicit(&p->gen[idx], memory_order_relaxed), idx);
+}
+
+int bram_pool_free(bram_pool_t *p, bram_handle_t h, uint32_t owner)
+{
+    uint32_t idx = bram_pool_index(h);
+    uint32_t expected = owner;
+    uint16_t gen;
+
+    if (idx >= p->count || !bram_pool_valid(p, h) ||
+        !atomic_compare_exchange_strong_explicit(&p->owner[idx], &expected,
+                                                 BRAM_POOL_OWNER_FREE,
+                                                 memory_order_acq_rel,
+                                                 memory_order_relaxed)) {
+        atomic_fetch_add_explicit(&p->owner_fault, 1, memory_order_relaxed);
+        return -1;
+    }
+
+    /* 세대 증가 → 이 블록을 가리키던 기존 핸들은 무효 (0은 건너뜀) */
+    gen = (uint16_t)(atomic_load_explicit(&p->gen[idx], memory_order_relaxed) + 1);
+    atomic_store_explicit(&p->gen[idx], gen != 0 ? gen : 1, memory_order_relaxed);
+
+    atomic_fetch_sub_explicit(&p->in_use, 1, memory_order_relaxed);
+    push_free(p, (uint16_t)idx);
+    return 0;
+}
+
+int bram_pool_transfer(bram_pool_t *p, bram_handle_t h, uint32_t from, uint32_t to)
+{
+    uint32_t idx = bram_pool_index(h);
+    uint32_t expected = from;
+
+    if (to == BRAM_POOL_OWNER_FREE || idx >= p->count || !bram_pool_valid(p, h) ||
+        !atomic_compare_exchange_strong_explicit(&p->owner[idx], &expected, to,
+                                                 memory_order_acq_rel,
+                                                 memory_order_relaxed)) {
+        atomic_fetch_add_explicit(&p->owner_fault, 1, memory_order_relaxed);
+        return -1;
+    }
+    return 0;
+}
+
+int bram_pool_valid(const bram_pool_t *p, bram_handle_t h)
+{
+    uint32_t idx = bram_pool_index(h);
+
+    if (h == BRAM_HANDLE_NONE || idx >= p->count) {
+        return 0;
+    }
+    return (uint16_t)(h >> 16) ==
+               atomic_load_explicit((_Atomic uint16_t *)&p->gen[idx], memory_order_relaxed) &&
+           atomic_load_explicit((_Atomic uint32_t *)&p->owner[idx], memory_order_relaxed) !=
+               BRAM_POOL_OWNER_FREE;
+}
+
+/*******************************************************************************
+ * 핸들 링 (SPSC)
+ ******************************************************************************/
+void bram_ring_init(bram_ring_t *r)
+{
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+}
+
+int bram_ring_push(bram_ring_t *r, bram_handle_t h)
+{
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+
+    if (tail - head >= BRAM_RING_SIZE) {
+        return -1;
+    }
+    r->slot[tail & (BRAM_RING_SIZE - 1)] = h;
+    /* release: 블록에 쓴 데이터가 핸들보다 먼저 보이도록 */
+    atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+    return 0;
+}
+
+bram_handle_t bram_ring_pop(bram_ring_t *r)
+{
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+    bram_handle_t h;
+
+    if (head == tail) {
+        return BRAM_HANDLE_NONE;
+    }
+    h = r->slot[head & (BRAM_RING_SIZE - 1)];
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+    return h;
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Userspace Access - 고정 블록 풀
+ *
+ * File: bram_pool.h
+ * Description: 매핑된 BRAM 창 위의 고정 크기 블록 할당기
+ *              - O(1) alloc/free (lock-free Treiber 스택, ABA 태그)
+ *              - 블록별 소유자 태그 (파이프라인 스테이지 ID)
+ *              - 세대 번호가 포함된 핸들 (해제된 블록의 재사용 검출)
+ *              - 스테이지 간 핸들 전달용 SPSC 링 (데이터 복사 없음)
+ *
+ * 메타데이터(free list, 태그)는 일반 DDR 메모리에 둡니다.
+ * AXI BRAM Controller는 exclusive access(LDXR/STXR)를 지원하지 않으므로
+ * BRAM 자체에는 원자 연산을 하지 않고, 블록 데이터만 BRAM에 있습니다.
+ ******************************************************************************/
+
+#ifndef BRAM_POOL_H
+#define BRAM_POOL_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "bram_map.h"
+
+#define BRAM_POOL_MIN_BLOCK     16      /* bytes */
+#define BRAM_POOL_MAX_BLOCKS    (BRAM_SIZE_BYTES / BRAM_POOL_MIN_BLOCK)
+#define BRAM_POOL_OWNER_FREE    0u
+
+/* 핸들: [31:16] 세대, [15:0] 블록 인덱스. 0은 "핸들 없음" */
+typedef uint32_t bram_handle_t;
+#define BRAM_HANDLE_NONE        0u
+
+typedef struct {
+    const bram_map_t   *map;
+    uint32_t            offset;         /* 풀 시작 (BRAM 바이트 오프셋) */
+    uint32_t            block_size;     /* bytes, 2의 거듭제곱 */
+    uint32_t            block_words;
+    uint32_t            count;          /* 블록 수 */
+
+    /* free list 헤드: [63:16] ABA 태그, [15:0] 인덱스 (0xFFFF = 비어 있음) */
+    _Atomic uint64_t    head;
+    _Atomic uint16_t    next[BRAM_POOL_MAX_BLOCKS];
+    _Atomic uint16_t    gen[BRAM_POOL_MAX_BLOCKS];
+    _Atomic uint32_t    owner[BRAM_POOL_MAX_BLOCKS];
+
+    /* 통계 */
+    _Atomic uint32_t    in_use;
+    _Atomic uint32_t    high_water;
+    _Atomic uint32_t    alloc_fail;
+    _Atomic uint32_t    owner_fault;    /* 잘못된 소유자/stale 핸들로 free/transfer */
+} bram_pool_t;
+
+/*
+ * BRAM [offset, offset + bytes) 영역을 block_size 블록으로 나눕니다.
+ * 서로 겹치지 않는 영역으로 여러 풀(크기 클래스별)을 만들 수 있습니다.
+ * 반환: 0 성공, -1 인자 오류
+ */
+int bram_pool_init(bram_pool_t *p, const bram_map_t *map,
+                   uint32_t offset, uint32_t bytes, uint32_t block_size);
+
+/* 블록 할당 (owner != 0). 비어 있으면 BRAM_HANDLE_NONE */
+bram_handle_t bram_pool_alloc(bram_pool_t *p, uint32_t owner);
+
+/* 블록 해제. owner가 현재 소유자와 다르거나 stale 핸들이면 -1 */
+int bram_pool_free(bram_pool_t *p, bram_handle_t h, uint32_t owner);
+
+/* 소유권 이전 (from → to). 데이터는 이동하지 않음 */
+int bram_pool_transfer(bram_pool_t *p, bram_handle_t h, uint32_t from, uint32_t to);
+
+/* 핸들 유효성 (세대 일치 + 할당 상태) */
+int bram_pool_valid(const bram_pool_t *p, bram_handle_t h);
+
+static inline uint32_t bram_pool_index(bram_handle_t h)
+{
+    return h & 0xFFFFu;
+}
+
+/* 블록 데이터 포인터 (BRAM 매핑 안, 32비트 워드 단위로 접근) */
+static inline volatile uint32_t *bram_pool_ptr(const bram_pool_t *p, bram_handle_t h)
+{
+    return p->map->base + (p->offset + bram_pool_index(h) * p->block_size) / 4;
+}
+
+/* 블록의 BRAM 바이트 오프셋 (ILA 트리거/디버그용) */
+static inline uint32_t bram_pool_offset(const bram_pool_t *p, bram_handle_t h)
+{
+    return p->offset + bram_pool_index(h) * p->block_size;
+}
+
+/*******************************************************************************
+ * 핸들 링 (단일 생산자 / 단일 소비자)
+ ******************************************************************************/
+#define BRAM_RING_SIZE          64      /* 2의 거듭제곱 */
+
+typedef struct {
+    _Atomic uint32_t    head;           /* 소비자 */
+    _Atomic uint32_t    tail;           /* 생산자 */
+    bram_handle_t       slot[BRAM_RING_SIZE];
+} bram_ring_t;
+
+void bram_ring_init(bram_ring_t *r);
+int bram_ring_push(bram_ring_t *r, bram_handle_t h);    /* 0 성공, -1 가득 참 */
+bram_handle_t bram_ring_pop(bram_ring_t *r);            /* 비어 있으면 NONE */
+
+#endif /* BRAM_POOL_H */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Userspace Access - DDR → BRAM 스트리밍
+ *
+ * File: bram_stream.h
+ * Description: BRAM을 N개 슬롯(ping-pong, N=2 기본)으로 나누어
+ *              생산자 스레드가 DDR 데이터를 다음 슬롯에 채우는 동안
+ *              소비자가 이전 슬롯을 처리하도록 전송과 연산을 겹침
+ *
+ * 슬롯 상태(EMPTY/FULL)는 DDR의 원자 변수로 관리하고,
+ * 슬롯 데이터만 BRAM에 있습니다.
+ ******************************************************************************/
+
+#ifndef BRAM_STREAM_H
+#define BRAM_STREAM_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bram_map.h"
+
+#define BRAM_STREAM_MAX_SLOTS   8
+
+/*
+ * 소비자 연산 콜백: 슬롯 하나(words 워드)를 처리
+ * seq는 0부터 증가하는 청크 번호
+ */
+typedef void (*bram_stream_fn)(void *ctx, const volatile uint32_t *slot,
+                               uint32_t words, uint32_t seq);
+
+typedef struct {
+    uint64_t    bytes;              /* 전송한 총 바이트 */
+    uint32_t    chunks;
+    uint64_t    wall_ns;            /* 첫 전송 시작 ~ 마지막 연산 종료 */
+    uint64_t    xfer_ns;            /* 생산자: DDR → BRAM 복사 시간 합 */
+    uint64_t    compute_ns;         /* 소비자: 콜백 시간 합 */
+    uint64_t    stall_ns;           /* 소비자: 데이터 대기 시간 합 (노출된 전송) */
+    uint64_t    backpressure_ns;    /* 생산자: 빈 슬롯 대기 시간 합 */
+} bram_stream_stats_t;
+
+typedef struct {
+    const bram_map_t   *map;
+    uint32_t            offset;         /* BRAM 바이트 오프셋 */
+    uint32_t            nslots;
+    uint32_t            slot_words;
+    int                 producer_cpu;   /* -1: 고정 안 함 */
+
+    /* 실행 중 상태 */
+    _Atomic uint32_t    full[BRAM_STREAM_MAX_SLOTS];
+    uint32_t            len[BRAM_STREAM_MAX_SLOTS];
+    const uint32_t     *src;
+    size_t              src_words;
+    uint64_t            xfer_ns;
+    uint64_t            backpressure_ns;
+} bram_stream_t;
+
+/*
+ * BRAM [offset, offset + bytes) 를 nslots 개 슬롯으로 분할
+ * nslots == 1 이면 스레드 없이 전송 → 연산을 순차 실행 (비교 기준)
+ * 반환: 0 성공, -1 인자 오류
+ */
+int bram_stream_init(bram_stream_t *s, const bram_map_t *map,
+                     uint32_t offset, uint32_t bytes, uint32_t nslots);
+
+/*
+ * src (DDR, src_words 워드) 전체를 슬롯 단위로 스트리밍하며 fn 호출
+ * 소비자 콜백은 호출한 스레드에서 실행됩니다.
+ */
+int bram_stream_run(bram_stream_t *s, const uint32_t *src, size_t src_words,
+                    bram_stream_fn fn, void *ctx, bram_stream_stats_t *stats);
+
+/* 처리량 (MB/s) 과 연산 뒤로 숨겨진 전송 시간 비율 (%) */
+double bram_stream_mbps(const bram_stream_stats_t *st);
+double bram_stream_hidden_pct(const bram_stream_stats_t *st);
+
+#endif /* BRAM_STREAM_H */
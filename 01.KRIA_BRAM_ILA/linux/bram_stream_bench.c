@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Streaming Benchmark
+ *
+ * File: bram_stream_bench.c
+ * Description: DDR 버퍼를 BRAM 슬롯(1 = 순차, 2 = ping-pong, N-way)으로
+ *              스트리밍하면서 워드당 연산량을 바꿔 가며
+ *              지속 처리량(MB/s)과 연산 뒤로 숨겨진 전송 시간 비율(%)을 측정
+ *
+ * Usage: bram_stream_bench [-d <spec>] [-m <source KB>] [-s <slots,...>]
+ *                          [-k <ops per word,...>] [-p <producer cpu>]
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bram_stream.h"
+
+#define DEFAULT_SOURCE_KB   4096
+#define MAX_LIST            8
+
+typedef struct {
+    unsigned    ops;            /* 워드당 연산 반복 수 */
+    uint32_t    acc;
+    uint64_t    sum;
+    uint32_t    next_seq;
+    unsigned    seq_errors;
+} compute_ctx_t;
+
+/**
+ * @brief 소비자 연산: 워드마다 ops회 LCG 혼합 후 누적
+ */
+static void compute_slot(void *arg, const volatile uint32_t *slot, uint32_t words, uint32_t seq)
+{
+    compute_ctx_t *c = (compute_ctx_t *)arg;
+    uint32_t i, x;
+    unsigned k;
+
+    if (seq != c->next_seq) {
+        c->seq_errors++;
+    }
+    c->next_seq = seq + 1;
+
+    for (i = 0; i < words; i++) {
+        x = slot[i];
+        c->sum += x;
+        for (k = 0; k < c->ops; k++) {
+            x = x * 1664525u + 1013904223u;
+        }
+        c->acc ^= x;
+    }
+}
+
+/**
+ * @brief DDR 원본에서 직접 계산한 기대값
+ */
+static void compute_reference(const uint32_t *src, size_t words, unsigned ops,
+                              uint32_t *acc, uint64_t *sum)
+{
+    size_t i;
+    uint32_t x;
+    unsigned k;
+
+    *acc = 0;
+    *sum = 0;
+    for (i = 0; i < words; i++) {
+        x = src[i];
+        *sum += x;
+        for (k = 0; k < ops; k++) {
+            x = x * 1664525u + 1013904223u;
+        }
+        *acc ^= x;
+    }
+}
+
+static int parse_list(char *arg, unsigned *out, unsigned max_value)
+{
+    char *tok = strtok(arg, ",");
+    int n = 0;
+
+    while (tok != NULL && n < MAX_LIST) {
+        unsigned v = (unsigned)strtoul(tok, NULL, 0);
+        if (v <= max_value) {
+            out[n++] = v;
+        }
+        tok = strtok(NULL, ",");
+    }
+    return n;
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [-d <spec>] [-m <source KB>] [-s <slots,...>]\n", prog);
+    printf("       %*s [-k <ops per word,...>] [-p <producer cpu>]\n", (int)strlen(prog), "");
+    printf("  spec: uio:<name> | devmem[:addr] | anon | file:<path>\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *spec = NULL;
+    unsigned source_kb = DEFAULT_SOURCE_KB;
+    unsigned slots[MAX_LIST] = { 1, 2, 3, 4 };
+    unsigned ops[MAX_LIST] = { 0, 4, 16, 64 };
+    int nslots = 4, nops = 4;
+    int producer_cpu = 0;
+    int ncpu = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    bram_map_t bram;
+    uint32_t *src;
+    size_t words, i;
+    int opt, si, oi, rc = 0;
+
+    while ((opt = getopt(argc, argv, "d:m:s:k:p:h")) != -1) {
+        switch (opt) {
+            case 'd': spec = optarg; break;
+            case 'm': source_kb = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 's': nslots = parse_list(optarg, slots, BRAM_STREAM_MAX_SLOTS); break;
+            case 'k': nops = parse_list(optarg, ops, 100000); break;
+            case 'p': producer_cpu = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (source_kb < 1 || nslots == 0 || nops == 0 || ncpu < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (bram_map_open(&bram, spec) != 0) {
+        return 2;
+    }
+
+    words = (size_t)source_kb * 1024 / 4;
+    src = malloc(words * sizeof(uint32_t));
+    if (src == NULL) {
+        fprintf(stderr, "ERROR: cannot allocate %u KB source buffer\n", source_kb);
+        bram_map_close(&bram);
+        return 1;
+    }
+    for (i = 0; i < words; i++) {
+        src[i] = (uint32_t)(i * 0x9E3779B9u) ^ 0xA5A5A5A5u;
+    }
+
+    /* 소비자(호출 스레드)는 생산자 다음 CPU에 고정 */
+    if (ncpu > 1) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET((producer_cpu + 1) % ncpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+
+    printf("BRAM streaming benchmark (DDR -> BRAM slots -> compute)\n");
+    printf("  Backend: %s (%s), %zu bytes\n", bram_map_kind_name(&bram), bram.path, bram.size);
+    printf("  Source: %u KB in DDR, producer CPU %d, consumer CPU %d\n\n",
+           source_kb, producer_cpu % ncpu, ncpu > 1 ? (producer_cpu + 1) % ncpu : 0);
+    if (ncpu < 2) {
+        printf("  WARNING: only 1 CPU online, producer and consumer cannot overlap\n\n");
+    }
+    printf("Slots  Slot(B)  Ops/w     MB/s  xfer(ms)  comp(ms) stall(ms)  Hidden  Check\n");
+    printf("-----  -------  -----  -------  --------  -------- ---------  ------  -----\n");
+
+    for (oi = 0; oi < nops; oi++) {
+        uint32_t ref_acc;
+        uint64_t ref_sum;
+
+        compute_reference(src, words, ops[oi], &ref_acc, &ref_sum);
+
+        for (si = 0; si < nslots; si++) {
+            bram_stream_t stream;
+            bram_stream_stats_t st;
+            compute_ctx_t ctx;
+            int ok;
+
+            if (slots[si] < 1 ||
+                bram_stream_init(&stream, &bram, 0, (uint32_t)bram.size, slots[si]) != 0) {
+                rc = 1;
+                continue;
+            }
+            stream.producer_cpu = producer_cpu % ncpu;
+
+            memset(&ctx, 0, sizeof(ctx));
+            ctx.ops = ops[oi];
+            if (bram_stream_run(&stream, src, words, compute_slot, &ctx, &st) != 0) {
+                rc = 1;
+                continue;
+            }
+
+            ok = (ctx.acc == ref_acc && ctx.sum == ref_sum && ctx.seq_errors == 0);
+            if (!ok) {
+                rc = 1;
+            }
+            printf("%5u  %7u  %5u  %7.1f  %8.2f  %8.2f %9.2f  %5.1f%%  %s\n",
+                   slots[si], stream.slot_words * 4, ops[oi], bram_stream_mbps(&st),
+                   st.xfer_ns / 1e6, st.compute_ns / 1e6, st.stall_ns / 1e6,
+                   bram_stream_hidden_pct(&st), ok ? "PASS" : "FAIL");
+        }
+    }
+
+    free(src);
+    bram_map_close(&bram);
+    return rc;
+}
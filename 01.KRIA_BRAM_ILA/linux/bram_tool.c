@@ -0,0 +1,424 @@
+/*******************************************************************************
+ * KV260 BRAM Linux Userspace Test Tool
+ *
+ * File: bram_tool.c
+ * Description: vitis/src/main.c의 fill/read/verify/benchmark 기능을
+ *              Linux 유저 공간에서 mmap(UIO, /dev/mem)으로 수행
+ *
+ * Usage: bram_tool [-d <spec>] <command> [args] [<command> [args] ...]
+ *   spec: uio:<name|/dev/uioN> | devmem[:addr] | anon | file:<path>
+ *
+ * 명령은 순서대로 실행되므로 anon 매핑에서도 한 번의 실행으로
+ * 쓰기 → 검증을 테스트할 수 있습니다.
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bram_map.h"
+
+/* 테스트 패턴 (main.c와 동일한 번호) */
+#define PATTERN_INCREMENT       1
+#define PATTERN_ADDRESS         2
+#define PATTERN_CHECKERBOARD    3
+#define PATTERN_WALKING_ONES    4
+#define PATTERN_ALL_ONES        5
+#define PATTERN_ALL_ZEROS       6
+
+#define MAX_MULTI_WORDS         64
+#define DEFAULT_BENCH_ROUNDS    256
+
+static bram_map_t bram;
+
+/*******************************************************************************
+ * 유틸리티
+ ******************************************************************************/
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static int validate_offset(uint32_t offset)
+{
+    if (offset > BRAM_MAX_OFFSET) {
+        fprintf(stderr, "ERROR: Offset %u exceeds maximum %d!\n", offset, BRAM_MAX_OFFSET);
+        return 0;
+    }
+    return 1;
+}
+
+/* start부터 count 워드가 BRAM 안에 있는지 (count = 0 포함 거부, u32 wrap 없음) */
+static int validate_range(uint32_t start, uint32_t count)
+{
+    if (!validate_offset(start)) {
+        return 0;
+    }
+    if (count == 0 || count > BRAM_SIZE_WORDS - start) {
+        fprintf(stderr, "ERROR: invalid range: %u words at offset %u (BRAM has %d words)!\n",
+                count, start, BRAM_SIZE_WORDS);
+        return 0;
+    }
+    return 1;
+}
+
+static uint32_t parse_u32(const char *s)
+{
+    return (uint32_t)strtoul(s, NULL, 0);
+}
+
+/**
+ * @brief 패턴 번호에 해당하는 기대값 (main.c test_pattern_write와 동일)
+ */
+static int pattern_value(int pattern, uint32_t i, uint32_t *value)
+{
+    switch (pattern) {
+        case PATTERN_INCREMENT:    *value = i; break;
+        case PATTERN_ADDRESS:      *value = (uint32_t)bram.phys + (i * 4); break;
+        case PATTERN_CHECKERBOARD: *value = (i & 1) ? 0xAA55AA55 : 0x55AA55AA; break;
+        case PATTERN_WALKING_ONES: *value = 1U << (i % 32); break;
+        case PATTERN_ALL_ONES:     *value = 0xFFFFFFFF; break;
+        case PATTERN_ALL_ZEROS:    *value = 0x00000000; break;
+        default:
+            return -1;
+    }
+    return 0;
+}
+
+static void hex_dump(uint32_t start, uint32_t count)
+{
+    uint32_t i, j, data;
+
+    printf("Offset    Address     Data\n");
+    printf("------    --------    --------\n");
+    for (i = 0; i < count; i++) {
+        data = bram_rd32(&bram, start + i);
+        printf("%4u      0x%08X  0x%08X  |", start + i,
+               (uint32_t)bram.phys + (start + i) * 4, data);
+        for (j = 0; j < 4; j++) {
+            char c = (char)((data >> (24 - j * 8)) & 0xFF);
+            putchar((c >= 32 && c < 127) ? c : '.');
+        }
+        printf("|\n");
+    }
+}
+
+/*******************************************************************************
+ * 명령 구현
+ ******************************************************************************/
+static int cmd_info(void)
+{
+    printf("BRAM Configuration:\n");
+    printf("  - Backend:      %s (%s)\n", bram_map_kind_name(&bram), bram.path);
+    printf("  - Base Address: 0x%08llX\n", (unsigned long long)bram.phys);
+    printf("  - Size:         %zu bytes (%zu KB)\n", bram.size, bram.size / 1024);
+    printf("  - Word Count:   %d (32-bit words)\n", BRAM_SIZE_WORDS);
+    printf("  - Mapped at:    %p\n", (void *)bram.base);
+    return 0;
+}
+
+static int cmd_write(uint32_t offset, uint32_t data)
+{
+    uint32_t readback;
+
+    if (!validate_offset(offset)) {
+        return 1;
+    }
+    bram_wr32(&bram, offset, data);
+    readback = bram_rd32(&bram, offset);
+    printf("Write 0x%08X @ %u, readback 0x%08X: %s\n", data, offset, readback,
+           readback == data ? "OK" : "MISMATCH");
+    return readback == data ? 0 : 1;
+}
+
+static int cmd_write_multiple(uint32_t start, int argc, char **argv)
+{
+    uint32_t i, count = (uint32_t)argc;
+    uint32_t data[MAX_MULTI_WORDS];
+    uint32_t errors = 0;
+
+    if (count > MAX_MULTI_WORDS) {
+        fprintf(stderr, "ERROR: write-multi takes at most %d words (got %u)\n",
+                MAX_MULTI_WORDS, count);
+        return 1;
+    }
+    if (!validate_range(start, count)) {
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        data[i] = parse_u32(argv[i]);
+        bram_wr32(&bram, start + i, data[i]);
+    }
+    for (i = 0; i < count; i++) {
+        if (bram_rd32(&bram, start + i) != data[i]) {
+            errors++;
+        }
+    }
+    printf("Wrote %u words at %u: %u errors\n", count, start, errors);
+    return errors ? 1 : 0;
+}
+
+static int cmd_fill(uint32_t value)
+{
+    uint32_t i;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        bram_wr32(&bram, i, value);
+    }
+    printf("Filled %d words with 0x%08X\n", BRAM_SIZE_WORDS, value);
+    return 0;
+}
+
+static int cmd_read(uint32_t start, uint32_t count)
+{
+    if (!validate_range(start, count)) {
+        return 1;
+    }
+    hex_dump(start, count);
+    return 0;
+}
+
+static int cmd_read_all(void)
+{
+    uint32_t i, data;
+    uint32_t non_zero = 0, first = 0, last = 0;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        data = bram_rd32(&bram, i);
+        if (data != 0) {
+            if (non_zero == 0) {
+                first = i;
+            }
+            last = i;
+            non_zero++;
+        }
+    }
+    printf("Summary:\n");
+    printf("  - Total words: %d\n", BRAM_SIZE_WORDS);
+    printf("  - Non-zero words: %u\n", non_zero);
+    if (non_zero > 0) {
+        printf("  - First non-zero at offset: %u (0x%08X)\n", first, bram_rd32(&bram, first));
+        printf("  - Last non-zero at offset: %u (0x%08X)\n", last, bram_rd32(&bram, last));
+    }
+    return 0;
+}
+
+static int cmd_pattern(int pattern)
+{
+    uint32_t i, value;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        if (pattern_value(pattern, i, &value) != 0) {
+            fprintf(stderr, "ERROR: invalid pattern %d (1-6)\n", pattern);
+            return 1;
+        }
+        bram_wr32(&bram, i, value);
+    }
+    printf("Pattern %d written to %d words\n", pattern, BRAM_SIZE_WORDS);
+    return 0;
+}
+
+static int cmd_verify(int pattern)
+{
+    uint32_t i, expected, actual;
+    uint32_t errors = 0;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        if (pattern_value(pattern, i, &expected) != 0) {
+            fprintf(stderr, "ERROR: invalid pattern %d (1-6)\n", pattern);
+            return 1;
+        }
+        actual = bram_rd32(&bram, i);
+        if (actual != expected) {
+            if (errors < 10) {
+                printf("ERROR at offset %u: expected 0x%08X, got 0x%08X\n",
+                       i, expected, actual);
+            }
+            errors++;
+        }
+    }
+    if (errors == 0) {
+        printf("SUCCESS: All %d words verified correctly!\n", BRAM_SIZE_WORDS);
+    } else {
+        printf("FAILED: %u errors found!\n", errors);
+    }
+    return errors ? 1 : 0;
+}
+
+/**
+ * @brief ILA 버스트 (main.c test_ila_burst와 동일한 액세스 패턴)
+ */
+static int cmd_burst(int type, uint32_t count)
+{
+    uint32_t i;
+    volatile uint32_t dummy = 0;
+
+    switch (type) {
+        case 1:
+            for (i = 0; i < 100; i++) bram_wr32(&bram, i, 0xDEAD0000 | i);
+            break;
+        case 2:
+            for (i = 0; i < 100; i++) dummy = bram_rd32(&bram, i);
+            break;
+        case 3:
+            for (i = 0; i < 50; i++) {
+                bram_wr32(&bram, i, 0xBEEF0000 | i);
+                dummy = bram_rd32(&bram, i);
+            }
+            break;
+        case 4:
+            if (count > BRAM_SIZE_WORDS) count = BRAM_SIZE_WORDS;
+            for (i = 0; i < count; i++) bram_wr32(&bram, i % BRAM_SIZE_WORDS, 0xCAFE0000 | i);
+            break;
+        default:
+            fprintf(stderr, "ERROR: invalid burst type %d (1-4)\n", type);
+            return 1;
+    }
+    (void)dummy;
+    printf("Burst %d complete\n", type);
+    return 0;
+}
+
+/**
+ * @brief 전체 BRAM 쓰기/읽기 처리량 (워드 단위, 디바이스 메모리 안전)
+ */
+static int cmd_bench(uint32_t rounds)
+{
+    uint32_t r, i;
+    uint32_t sum = 0;
+    double t0, t_wr, t_rd;
+    double mb = (double)rounds * BRAM_SIZE_BYTES / 1e6;
+
+    t0 = now_sec();
+    for (r = 0; r < rounds; r++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            bram_wr32(&bram, i, i ^ r);
+        }
+    }
+    t_wr = now_sec() - t0;
+
+    t0 = now_sec();
+    for (r = 0; r < rounds; r++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            sum += bram_rd32(&bram, i);
+        }
+    }
+    t_rd = now_sec() - t0;
+
+    printf("Benchmark (%s, %u rounds, %.2f MB per direction):\n",
+           bram_map_kind_name(&bram), rounds, mb);
+    printf("  Write: %9.2f MB/s  (%.1f ns/word)\n", mb / t_wr,
+           t_wr * 1e9 / ((double)rounds * BRAM_SIZE_WORDS));
+    printf("  Read:  %9.2f MB/s  (%.1f ns/word)  [sum 0x%08X]\n", mb / t_rd,
+           t_rd * 1e9 / ((double)rounds * BRAM_SIZE_WORDS), sum);
+    return 0;
+}
+
+/*******************************************************************************
+ * 메인
+ ******************************************************************************/
+static void usage(const char *prog)
+{
+    printf("Usage: %s [-d <spec>] <command> [args] ...\n", prog);
+    printf("\n");
+    printf("Device spec (default $BRAM_DEV or %s):\n", BRAM_MAP_DEFAULT);
+    printf("  uio:<name>|uio:/dev/uioN   UIO device\n");
+    printf("  devmem[:<addr>]            /dev/mem (default 0x%08lX)\n", BRAM_PHYS_ADDR);
+    printf("  anon                       anonymous mmap (host test)\n");
+    printf("  file:<path>                file-backed mmap (host test)\n");
+    printf("\n");
+    printf("Commands:\n");
+    printf("  info                       show mapping info\n");
+    printf("  write <off> <data>         write single word (verified)\n");
+    printf("  write-multi <off> <d>...   write up to %d consecutive words (verified)\n",
+           MAX_MULTI_WORDS);
+    printf("  fill <value>               fill all BRAM\n");
+    printf("  clear                      fill all BRAM with 0\n");
+    printf("  read <off> [count]         hex dump (count 1..%d - off)\n", BRAM_SIZE_WORDS);
+    printf("  read-all                   non-zero summary\n");
+    printf("  pattern <1-6>              write test pattern\n");
+    printf("  verify <1-6>               verify test pattern\n");
+    printf("  burst <1-4> [count]        ILA burst access\n");
+    printf("  bench [rounds]             throughput (default %d rounds)\n",
+           DEFAULT_BENCH_ROUNDS);
+    printf("\n");
+    printf("Patterns: 1=increment 2=address 3=checkerboard 4=walking ones\n");
+    printf("          5=all 0xFFFFFFFF 6=all 0x00000000\n");
+}
+
+/* 다음 인자가 명령이 아니면 숫자로 사용 */
+static int has_arg(int i, int argc, char **argv)
+{
+    return (i < argc) && (argv[i][0] >= '0' && argv[i][0] <= '9');
+}
+
+int main(int argc, char **argv)
+{
+    const char *spec = NULL;
+    int i = 1;
+    int status = 0;
+
+    if (argc > 2 && strcmp(argv[1], "-d") == 0) {
+        spec = argv[2];
+        i = 3;
+    }
+    if (i >= argc || strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+        usage(argv[0]);
+        return (i >= argc) ? 1 : 0;
+    }
+
+    if (bram_map_open(&bram, spec) != 0) {
+        return 2;
+    }
+
+    while (i < argc && status == 0) {
+        const char *cmd = argv[i++];
+
+        if (strcmp(cmd, "info") == 0) {
+            status = cmd_info();
+        } else if (strcmp(cmd, "write") == 0 && has_arg(i + 1, argc, argv)) {
+            status = cmd_write(parse_u32(argv[i]), parse_u32(argv[i + 1]));
+            i += 2;
+        } else if (strcmp(cmd, "write-multi") == 0 && has_arg(i, argc, argv)) {
+            int n = 0;
+            uint32_t start = parse_u32(argv[i++]);
+            while (has_arg(i + n, argc, argv)) {
+                n++;
+            }
+            status = (n > 0) ? cmd_write_multiple(start, n, &argv[i]) : 1;
+            i += n;
+        } else if (strcmp(cmd, "fill") == 0 && has_arg(i, argc, argv)) {
+            status = cmd_fill(parse_u32(argv[i++]));
+        } else if (strcmp(cmd, "clear") == 0) {
+            status = cmd_fill(0);
+        } else if (strcmp(cmd, "read") == 0 && has_arg(i, argc, argv)) {
+            uint32_t start = parse_u32(argv[i++]);
+            uint32_t count = has_arg(i, argc, argv) ? parse_u32(argv[i++]) : 1;
+            status = cmd_read(start, count);
+        } else if (strcmp(cmd, "read-all") == 0) {
+            status = cmd_read_all();
+        } else if (strcmp(cmd, "pattern") == 0 && has_arg(i, argc, argv)) {
+            status = cmd_pattern(atoi(argv[i++]));
+        } else if (strcmp(cmd, "verify") == 0 && has_arg(i, argc, argv)) {
+            status = cmd_verify(atoi(argv[i++]));
+        } else if (strcmp(cmd, "burst") == 0 && has_arg(i, argc, argv)) {
+            int type = atoi(argv[i++]);
+            uint32_t count = has_arg(i, argc, argv) ? parse_u32(argv[i++]) : 100;
+            status = cmd_burst(type, count);
+        } else if (strcmp(cmd, "bench") == 0) {
+            uint32_t rounds = has_arg(i, argc, argv) ? parse_u32(argv[i++])
+                                                     : DEFAULT_BENCH_ROUNDS;
+            status = cmd_bench(rounds ? rounds : 1);
+        } else {
+            fprintf(stderr, "ERROR: unknown command or missing argument: %s\n", cmd);
+            status = 1;
+        }
+    }
+
+    bram_map_close(&bram);
+    return status;
+}
@@ -0,0 +1,980 @@
+/*==============================================================================
+ * Host simulation of the BRAM test hardware
+ *
+ * - BRAM window: 8KB anonymous mapping placed at the board address
+ *   (0x80000000), so both Xil_In32/Xil_Out32 and the C++ pointer-based
+ *   access layer work unchanged.
+ * - CRL_APB.PL0_REF_CTRL: plain register (IOPLL / 15 / 1 = 100 MHz).
+ *   IOPLL_CTRL / RPLL_CTRL hold the KV260 boot settings (33.333 MHz x 90 / 2
+ *   = 1500 MHz, x 72 / 2 = 1200 MHz); the PL models run at the clock SRCSEL
+ *   and the dividers select.
+ * - AXI BRAM Controller ECC (PG078): Hamming SEC-DED (39,32) check bits per
+ *   word, ECC_STATUS / CE_CNT / first-failing registers and one-shot fault
+ *   injection (FI_D, FI_ECC) on the next write.
+ *
+ * - Byte write enables: 8/16-bit writes update only their byte lanes. With
+ *   ECC on, the controller reads and corrects the old word, merges the lanes
+ *   and re-encodes it (internal read-modify-write, as in PG078).
+ *
+ * - Multi-bank build (-DBRAM_BANK_COUNT=2..4): plain 8KB banks behind
+ *   HPM0_FPD (0xA0000000, even banks) and HPM1_FPD (0xB0000000, odd banks),
+ *   8KB apart within a port, as create_project.tcl -banks places them.
+ *   Accesses to banks the build does not have are reported as unmapped.
+ *
+ * - SYSMON (AMS PS 0xFFA50800 / PL 0xFFA50C00): synthetic sensor source.
+ *   A load figure follows the rate of Xil_In/Out accesses with a 200 ms
+ *   time constant; temperatures rise and VCCINT / VCCBRAM droop with it,
+ *   plus +-1 LSB noise. Values are returned as SYSMON ADC codes.
+ * - TTC0 + GIC: interval interrupt driven by setitimer / SIGALRM, IRQ mask
+ *   = blocking SIGALRM (xttcps.h, xscugic.h, xil_exception.h stubs).
+ *
+ * - Stream ingest build (-DBRAM_STREAM_ENABLED=1): functional model of
+ *   vivado/src/stream_ingest.v at 0x80210000. Elapsed host time is turned
+ *   into PL cycles (PL0_REF_CTRL clock) whenever a register is accessed, and
+ *   the pattern generator / frame ring writer are stepped beat by beat with
+ *   the same backpressure rules and counters as the RTL. Frames land in the
+ *   BRAM window directly (port B, bypassing the controller model).
+ * - Vector kernel build (-DBRAM_KERNEL_ENABLED=1): ap_ctrl_hs registers of
+ *   the HLS bram_vec IP at 0x80220000. ap_start runs hls/bram_vec.cpp on the
+ *   BRAM window at once; ap_done / ap_idle follow after the cycle count the
+ *   synthesized loops would take (per-op II x count + fixed overhead) at the
+ *   PL0_REF_CTRL clock. ap_done clears on read.
+ *
+ * Words written through a raw pointer bypass the controller model. The model
+ * keeps a shadow of the last value it stored and treats a mismatch as a
+ * fresh write (check bits recomputed), so only injected faults show up.
+ *============================================================================*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+
+#include "xil_io.h"
+#include "xparameters.h"
+#include "xtime_l.h"
+#include "xscugic.h"
+#include "xttcps.h"
+#include "xil_exception.h"
+
+#ifndef BRAM_KERNEL_ENABLED
+#define BRAM_KERNEL_ENABLED 0
+#endif
+#if BRAM_KERNEL_ENABLED
+#include "bram_vec.h"
+#endif
+
+#define SIM_BRAM_BASE       XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
+#define SIM_BRAM_BYTES      0x2000U
+#define SIM_BRAM_WORDS      (SIM_BRAM_BYTES / 4)
+
+#define SIM_ECC_BASE        XPAR_AXI_BRAM_CTRL_0_S_AXI_CTRL_BASEADDR
+#define SIM_ECC_SPAN        0x1000U
+
+#define SIM_PL0_REF_CTRL    0xFF5E00C0U
+
+#ifndef BRAM_BANK_COUNT
+#define BRAM_BANK_COUNT     1
+#endif
+#define SIM_BANK_HPM0       0xA0000000U
+#define SIM_BANK_HPM1       0xB0000000U
+
+#define SIM_AMS_PS          0xFFA50800U
+#define SIM_AMS_PL          0xFFA50C00U
+#define SIM_AMS_SPAN        0x400U
+#define SIM_LOAD_FULL       50U             /* accesses per us for load 1000 */
+#define SIM_LOAD_TAU_NS     200000000LL
+#define SIM_GIC_IRQS        192U
+
+#ifndef BRAM_STREAM_ENABLED
+#define BRAM_STREAM_ENABLED 0
+#endif
+#define SIM_STREAM_BASE     0x80210000U
+#define SIM_STREAM_SPAN     0x1000U
+#define SIM_IOPLL_CTRL      0xFF5E0020U
+#define SIM_RPLL_CTRL       0xFF5E0030U
+#define SIM_PS_REF_HZ       33333333ULL
+
+#define SIM_KERNEL_BASE     0x80220000U
+#define SIM_KERNEL_SPAN     0x1000U
+#define SIM_KERNEL_OVERHEAD 12U             /* ap_start -> loop entry -> ap_done */
+
+/* PG078 register offsets */
+#define REG_ECC_STATUS      0x000
+#define REG_ECC_EN_IRQ      0x004
+#define REG_ECC_ONOFF       0x008
+#define REG_CE_CNT          0x00C
+#define REG_CE_FFD          0x100
+#define REG_CE_FFE          0x180
+#define REG_CE_FFA          0x1C0
+#define REG_UE_FFD          0x200
+#define REG_UE_FFE          0x280
+#define REG_UE_FFA          0x2C0
+#define REG_FI_D            0x300
+#define REG_FI_ECC          0x380
+
+#define STATUS_UE           0x1U
+#define STATUS_CE           0x2U
+#define CE_CNT_MAX          0xFFU
+
+XTime host_time_base;
+
+static volatile u32 *bram;
+static u32 pl0_ref_ctrl = (1U << 24) | (1U << 16) | (15U << 8);
+static u32 iopll_ctrl = (1U << 16) | (90U << 8);
+static u32 rpll_ctrl = (1U << 16) | (72U << 8);
+static const u32 sim_banks = BRAM_BANK_COUNT > 1 ? BRAM_BANK_COUNT : 0;
+static u32 bank_mem[4][SIM_BRAM_WORDS];
+
+static struct {
+    u8  check[SIM_BRAM_WORDS];
+    u32 shadow[SIM_BRAM_WORDS];
+    u32 status;
+    u32 en_irq;
+    u32 onoff;
+    u32 ce_cnt;
+    u32 ce_ffd, ce_ffe, ce_ffa;
+    u32 ue_ffd, ue_ffe, ue_ffa;
+    u32 fi_d, fi_ecc;
+} ecc;
+
+static struct {
+    u64 accesses;
+    u64 last_accesses;
+    XTime last;
+    s64 load;                       /* 0..1000 */
+    u32 noise;
+} sensor = { .noise = 1 };
+__attribute__((constructor))
+static void host_sim_init(void)
+{
+    void *p = mmap((void *)(UINTPTR)SIM_BRAM_BASE, SIM_BRAM_BYTES,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p != (void *)(UINTPTR)SIM_BRAM_BASE) {
+        perror("host_sim: cannot map BRAM window at 0x80000000");
+        exit(1);
+    }
+    bram = (volatile u32 *)p;
+    XTime_GetTime(&host_time_base);
+    ecc.onoff = 1;                  /* ECC_ONOFF_RESET_VALUE = 1 */
+}
+
+/*==============================================================================
+ * Hamming SEC-DED (39,32)
+ *
+ * Data bits occupy codeword positions 1..38 that are not powers of two;
+ * check bits 0..5 are the Hamming parities, bit 6 is overall parity.
+ *============================================================================*/
+static u8 data_pos[32];
+static u8 syn_table[4][256];        /* syndrome contribution per data byte */
+
+static void ecc_init_tables(void)
+{
+    u32 pos = 1, k = 0, b, v;
+
+    if (data_pos[0] != 0) {
+        return;
+    }
+    while (k < 32) {
+        pos++;
+        if ((pos & (pos - 1)) != 0) {
+            data_pos[k++] = (u8)pos;
+        }
+    }
+    for (b = 0; b < 4; b++) {
+        for (v = 0; v < 256; v++) {
+            u8 syn = 0;
+            for (k = 0; k < 8; k++) {
+                if (v & (1U << k)) {
+                    syn ^= data_pos[b * 8 + k];
+                }
+            }
+            syn_table[b][v] = syn;
+        }
+    }
+}
+
+static u32 parity32(u32 v)
+{
+    v ^= v >> 16;
+    v ^= v >> 8;
+    v ^= v >> 4;
+    v ^= v >> 2;
+    v ^= v >> 1;
+    return v & 1U;
+}
+
+static u8 ecc_encode(u32 data)
+{
+    u32 syn;
+
+    ecc_init_tables();
+    syn = syn_table[0][data & 0xFF] ^ syn_table[1][(data >> 8) & 0xFF] ^
+          syn_table[2][(data >> 16) & 0xFF] ^ syn_table[3][data >> 24];
+    /* overall parity makes the 39-bit codeword even */
+    return (u8)(syn | ((parity32(data) ^ parity32(syn)) << 6));
+}
+
+/* returns 0 clean, 1 corrected (*fixed updated), 2 uncorrectable */
+static int ecc_decode(u32 data, u8 check, u32 *fixed)
+{
+    u32 syn = (ecc_encode(data) ^ check) & 0x3FU;
+    u32 odd = parity32(data) ^ parity32(check & 0x7FU);
+    u32 k;
+
+    *fixed = data;
+    if (syn == 0 && !odd) {
+        return 0;
+    }
+    if (!odd) {
+        return 2;
+    }
+    if (syn == 0 || (syn & (syn - 1)) == 0) {
+        return 1;                   /* check bit flipped, data intact */
+    }
+    for (k = 0; k < 32; k++) {
+        if (data_pos[k] == syn) {
+            *fixed = data ^ (1U << k);
+            return 1;
+        }
+    }
+    return 2;
+}
+
+/*==============================================================================
+ * BRAM through the controller model
+ *============================================================================*/
+static u32 bram_read(UINTPTR addr)
+{
+    u32 off = (u32)(addr - SIM_BRAM_BASE) / 4;
+    u32 v = bram[off];
+    u32 fixed;
+
+    if (v != ecc.shadow[off]) {
+        ecc.check[off] = ecc_encode(v);
+        ecc.shadow[off] = v;
+    }
+    if (!(ecc.onoff & 1U)) {
+        return v;
+    }
+
+    switch (ecc_decode(v, ecc.check[off], &fixed)) {
+        case 1:
+            if (!(ecc.status & STATUS_CE)) {
+                ecc.ce_ffa = (u32)addr;
+                ecc.ce_ffd = v;
+                ecc.ce_ffe = ecc.check[off];
+            }
+            ecc.status |= STATUS_CE;
+            if (ecc.ce_cnt < CE_CNT_MAX) {
+                ecc.ce_cnt++;
+            }
+            return fixed;
+        case 2:
+            if (!(ecc.status & STATUS_UE)) {
+                ecc.ue_ffa = (u32)addr;
+                ecc.ue_ffd = v;
+                ecc.ue_ffe = ecc.check[off];
+            }
+            ecc.status |= STATUS_UE;
+            return v;
+        default:
+            return v;
+    }
+}
+
+static void bram_write(UINTPTR addr, u32 value)
+{
+    u32 off = (u32)(addr - SIM_BRAM_BASE) / 4;
+    u32 stored = value ^ ecc.fi_d;
+
+    ecc.check[off] = (u8)((ecc_encode(value) ^ ecc.fi_ecc) & 0x7FU);
+    bram[off] = stored;
+    ecc.shadow[off] = stored;
+    ecc.fi_d = 0;
+    ecc.fi_ecc = 0;
+}
+
+/* strb: one bit per byte lane, as on the AXI WSTRB signal */
+static void bram_write_strb(UINTPTR addr, u32 value, u32 strb)
+{
+    u32 mask = 0;
+    u32 lane, old;
+
+    if (strb == 0xFU) {
+        bram_write(addr, value);
+        return;
+    }
+    for (lane = 0; lane < 4; lane++) {
+        if (strb & (1U << lane)) {
+            mask |= 0xFFU << (lane * 8);
+        }
+    }
+    old = bram_read(addr);
+    bram_write(addr, (old & ~mask) | (value & mask));
+}
+
+static u32 ecc_reg_read(u32 reg)
+{
+    switch (reg) {
+        case REG_ECC_STATUS: return ecc.status;
+        case REG_ECC_EN_IRQ: return ecc.en_irq;
+        case REG_ECC_ONOFF:  return ecc.onoff;
+        case REG_CE_CNT:     return ecc.ce_cnt;
+        case REG_CE_FFD:     return ecc.ce_ffd;
+        case REG_CE_FFE:     return ecc.ce_ffe;
+        case REG_CE_FFA:     return ecc.ce_ffa;
+        case REG_UE_FFD:     return ecc.ue_ffd;
+        case REG_UE_FFE:     return ecc.ue_ffe;
+        case REG_UE_FFA:     return ecc.ue_ffa;
+        default:             return 0;
+    }
+}
+
+static void ecc_reg_write(u32 reg, u32 value)
+{
+    switch (reg) {
+        case REG_ECC_STATUS: ecc.status &= ~value; break;      /* W1C */
+        case REG_ECC_EN_IRQ: ecc.en_irq = value & 3U; break;
+        case REG_ECC_ONOFF:  ecc.onoff = value & 1U; break;
+        case REG_CE_CNT:     ecc.ce_cnt = value & CE_CNT_MAX; break;
+        case REG_FI_D:       ecc.fi_d = value; break;
+        case REG_FI_ECC:     ecc.fi_ecc = value & 0x7FU; break;
+        default: break;
+    }
+}
+
+/*==============================================================================
+ * FPD BRAM banks
+ *============================================================================*/
+/* returns the word in the bank behind addr, NULL if no such bank */
+static u32 *bank_word(UINTPTR addr)
+{
+    UINTPTR base;
+    u32 bank;
+
+    if (addr >= SIM_BANK_HPM0 && addr < SIM_BANK_HPM0 + 2 * SIM_BRAM_BYTES) {
+        base = SIM_BANK_HPM0;
+        bank = (u32)((addr - base) / SIM_BRAM_BYTES) * 2;
+    } else if (addr >= SIM_BANK_HPM1 && addr < SIM_BANK_HPM1 + 2 * SIM_BRAM_BYTES) {
+        base = SIM_BANK_HPM1;
+        bank = (u32)((addr - base) / SIM_BRAM_BYTES) * 2 + 1;
+    } else {
+        return NULL;
+    }
+    if (bank >= sim_banks) {
+        return NULL;
+    }
+    return &bank_mem[bank][((addr - base) % SIM_BRAM_BYTES) / 4];
+}
+
+/*==============================================================================
+ * SYSMON synthetic sensors
+ *============================================================================*/
+static void sensor_update(void)
+{
+    XTime now;
+    s64 dt, target;
+
+    XTime_GetTime(&now);
+    dt = (s64)(now - sensor.last);
+    if (dt < 100000) {
+        return;
+    }
+    target = (s64)((sensor.accesses - sensor.last_accesses) * 1000ULL * 1000ULL /
+                   ((u64)dt * SIM_LOAD_FULL));
+    if (target > 1000) {
+        target = 1000;
+    }
+    if (dt >= SIM_LOAD_TAU_NS) {
+        sensor.load = target;
+    } else {
+        sensor.load += (target - sensor.load) * dt / SIM_LOAD_TAU_NS;
+    }
+    sensor.last = now;
+    sensor.last_accesses = sensor.accesses;
+}
+
+static u32 code_noise(u32 code)
+{
+    sensor.noise = sensor.noise * 1103515245U + 12345U;
+    return code + ((sensor.noise >> 16) % 3) - 1;
+}
+
+static u32 temp_code(s64 mdeg)
+{
+    return code_noise((u32)((mdeg + 280231) * 65536 / 509314));
+}
+
+static u32 volt_code(s64 uv)
+{
+    return code_noise((u32)(uv * 65536 / 3000000));
+}
+
+static u32 ams_read(UINTPTR addr)
+{
+    int pl = addr >= SIM_AMS_PL;
+
+    sensor_update();
+    switch ((u32)(addr - (pl ? SIM_AMS_PL : SIM_AMS_PS))) {
+        case 0x000: return pl ? temp_code(40000 + sensor.load * 15)     /* PL temp */
+                              : temp_code(43000 + sensor.load * 8);     /* PS temp */
+        case 0x004: return pl ? volt_code(850000 - sensor.load * 12)    /* VCCINT */
+                              : volt_code(850000);                      /* VCC_PSINTLP */
+        case 0x018: return pl ? volt_code(850000 - sensor.load * 5)     /* VCCBRAM */
+                              : volt_code(1800000);                     /* VCC_PSAUX */
+        default:    return 0;
+    }
+}
+
+/*==============================================================================
+ * Stream ingest (pattern generator -> frame ring writer -> BRAM port B)
+ *============================================================================*/
+enum { ING_IDLE, ING_WRITE, ING_DROP };
+
+static struct {
+    u32 enable, drop_on_full;
+    u32 frame_words, slots, rate_div;
+    u32 state, beat, frame_no;      /* writer state, generator frame number */
+    u32 wr_slot, pending;
+    u32 wait;                       /* cycles until the generator's next beat */
+    u32 cycles, beats, frames, drop_beats, drop_frames, stall, fill_max;
+    XTime t_enable;
+    u64 cycles_done;
+} ingest = { .frame_words = 256, .slots = 8 };
+
+static u32 pl_khz(void)
+{
+    u32 div0 = (pl0_ref_ctrl >> 8) & 0x3FU;
+    u32 div1 = (pl0_ref_ctrl >> 16) & 0x3FU;
+    u32 pll = ((pl0_ref_ctrl & 7U) == 2) ? rpll_ctrl : iopll_ctrl;
+    u64 pll_hz = SIM_PS_REF_HZ * ((pll >> 8) & 0x7FU) / ((pll & (1U << 16)) ? 2 : 1);
+
+    return (u32)((pll_hz / ((div0 ? div0 : 1) * (div1 ? div1 : 1)) + 500) / 1000);
+}
+
+/* One generator beat handed to the writer */
+static void ingest_beat(u32 fw, u32 nslot)
+{
+    int room = ingest.pending < nslot;
+    int accept = ingest.state == ING_WRITE || (ingest.state == ING_IDLE && room);
+    int last = ingest.beat == fw - 1;
+
+    if (accept) {
+        bram[ingest.wr_slot * fw + ingest.beat] = (ingest.frame_no << 16) | ingest.beat;
+        ingest.beats++;
+    } else {
+        ingest.drop_beats++;
+    }
+    if (!last) {
+        if (ingest.state == ING_IDLE) {
+            ingest.state = accept ? ING_WRITE : ING_DROP;
+        }
+        ingest.beat++;
+        return;
+    }
+    if (accept) {
+        ingest.frames++;
+        ingest.pending++;
+        if (ingest.pending > ingest.fill_max) {
+            ingest.fill_max = ingest.pending;
+        }
+        ingest.wr_slot = (ingest.wr_slot + 1 >= nslot) ? 0 : ingest.wr_slot + 1;
+    } else {
+        ingest.drop_frames++;
+    }
+    ingest.state = ING_IDLE;
+    ingest.beat = 0;
+    ingest.frame_no = (ingest.frame_no + 1) & 0xFFFFU;
+}
+
+/* Advance the model to the current host time */
+static void ingest_update(void)
+{
+    u32 fw = ingest.frame_words ? ingest.frame_words : 1;
+    u32 nslot = ingest.slots ? ingest.slots : 1;
+    XTime now;
+    u64 target, n, step;
+
+    if (!ingest.enable) {
+        return;
+    }
+    XTime_GetTime(&now);
+    target = (u64)(now - ingest.t_enable) * pl_khz() / 1000000ULL;
+    n = target - ingest.cycles_done;
+    ingest.cycles_done = target;
+    ingest.cycles += (u32)n;
+
+    while (n > 0) {
+        if (ingest.wait > 0) {
+            step = n < ingest.wait ? n : ingest.wait;
+            ingest.wait -= (u32)step;
+            n -= step;
+            continue;
+        }
+        if (ingest.state == ING_IDLE && ingest.pending >= nslot && !ingest.drop_on_full) {
+            /* TVALID && !TREADY until the CPU releases a slot */
+            ingest.stall += (u32)n;
+            break;
+        }
+        ingest_beat(fw, nslot);
+        ingest.wait = ingest.rate_div;
+        n--;
+    }
+}
+
+static u32 ingest_reg_read(u32 reg)
+{
+    ingest_update();
+    switch (reg) {
+        case 0x00: return (ingest.drop_on_full << 1) | ingest.enable;
+        case 0x04: return ((u32)(ingest.state != ING_IDLE) << 1) | ingest.enable;
+        case 0x08: return ingest.frame_words;
+        case 0x0C: return ingest.slots;
+        case 0x10: return ingest.rate_div;
+        case 0x14: return ingest.wr_slot;
+        case 0x1C: return ingest.pending;
+        case 0x20: return ingest.cycles;
+        case 0x24: return ingest.beats;
+        case 0x28: return ingest.frames;
+        case 0x2C: return ingest.drop_beats;
+        case 0x30: return ingest.drop_frames;
+        case 0x34: return ingest.stall;
+        case 0x38: return ingest.fill_max;
+        case 0x3C: return 0x5354524DU;
+        default:   return 0;
+    }
+}
+
+static void ingest_reg_write(u32 reg, u32 value)
+{
+    ingest_update();
+    switch (reg) {
+        case 0x00:
+            if (value & 0x80000000U) {
+                ingest.cycles = ingest.beats = ingest.frames = 0;
+                ingest.drop_beats = ingest.drop_frames = ingest.stall = 0;
+                ingest.fill_max = 0;
+            }
+            ingest.drop_on_full = (value >> 1) & 1U;
+            if ((value & 1U) && !ingest.enable) {
+                XTime_GetTime(&ingest.t_enable);
+                ingest.cycles_done = 0;
+            }
+            ingest.enable = value & 1U;
+            if (!ingest.enable) {
+                /* ring and generator reset, as in the RTL */
+                ingest.state = ING_IDLE;
+                ingest.beat = 0;
+                ingest.frame_no = 0;
+                ingest.wr_slot = 0;
+                ingest.pending = 0;
+                ingest.wait = 0;
+            }
+            break;
+        case 0x08: ingest.frame_words = value & 0xFFFFU; break;
+        case 0x0C: ingest.slots = value & 0xFFFFU; break;
+        case 0x10: ingest.rate_div = value & 0xFFFFU; break;
+        case 0x18:
+            value &= 0xFFFFU;
+            ingest.pending -= value < ingest.pending ? value : ingest.pending;
+            break;
+        default:
+            break;
+    }
+}
+
+/*==============================================================================
+ * HLS vector kernel (bram_vec, ap_ctrl_hs)
+ *============================================================================*/
+#if BRAM_KERNEL_ENABLED
+static struct {
+    u32 args[6];                    /* op, base, count, arg_a, arg_b, dst */
+    u32 busy, done;
+    XTime t_done;
+} kernel;
+
+/* Loop cycles of the synthesized kernel (single-port BRAM: one access per cycle) */
+static u64 kernel_cycles(void)
+{
+    u64 count = kernel.args[2];
+    u32 bins = kernel.args[3];
+
+    switch (kernel.args[0]) {
+        case 0:  return count * 3;                  /* 2 reads + 1 write */
+        case 1:  return count * 2;                  /* read + write */
+        case 2:  return count + 2;                  /* read, then min / max */
+        case 3:  return count * 2 + (u64)bins * 2;  /* clear + count + write out */
+        default: return 0;
+    }
+}
+
+static void kernel_update(void)
+{
+    XTime now;
+
+    if (!kernel.busy) {
+        return;
+    }
+    XTime_GetTime(&now);
+    if (now >= kernel.t_done) {
+        kernel.busy = 0;
+        kernel.done = 1;
+    }
+}
+
+static u32 kernel_reg_read(u32 reg)
+{
+    u32 ctrl;
+
+    kernel_update();
+    if (reg == 0x00) {
+        ctrl = (kernel.done << 1) | ((u32)!kernel.busy << 2) | ((u32)!kernel.busy << 3);
+        kernel.done = 0;
+        return ctrl;
+    }
+    if (reg >= 0x10 && reg <= 0x38 && (reg & 7U) == 0) {
+        return kernel.args[(reg - 0x10) / 8];
+    }
+    return 0;
+}
+
+static void kernel_reg_write(u32 reg, u32 value)
+{
+    XTime now;
+
+    kernel_update();
+    if (reg == 0x00 && (value & 1U) && !kernel.busy) {
+        bram_vec((uint32_t *)bram, kernel.args[0], kernel.args[1], kernel.args[2],
+                 kernel.args[3], kernel.args[4], kernel.args[5]);
+        XTime_GetTime(&now);
+        kernel.t_done = now + (kernel_cycles() + SIM_KERNEL_OVERHEAD) * 1000000ULL / pl_khz();
+        kernel.busy = 1;
+        kernel.done = 0;
+    } else if (reg >= 0x10 && reg <= 0x38 && (reg & 7U) == 0) {
+        kernel.args[(reg - 0x10) / 8] = value;
+    }
+}
+#endif
+
+/*==============================================================================
+ * TTC0 + GIC
+ *============================================================================*/
+static XScuGic_Config gic_config = { 0, 0xF9020000U, 0xF9010000U };
+static XTtcPs_Config ttc_config = { 0, 0xFF110000U, 100000000U };
+
+static struct {
+    Xil_InterruptHandler handler;
+    void *ref;
+    int enabled;
+} gic_vec[SIM_GIC_IRQS];
+
+static Xil_ExceptionHandler irq_handler;
+static void *irq_data;
+static u32 irq_pending = SIM_GIC_IRQS;
+static XTtcPs *sim_ttc;
+
+static void sim_alarm(int sig)
+{
+    u32 id = XPAR_XTTCPS_0_INTR;
+
+    (void)sig;
+    if (sim_ttc == NULL || !sim_ttc->Started) {
+        return;
+    }
+    sim_ttc->IntrStatus |= XTTCPS_IXR_INTERVAL_MASK;
+    if ((sim_ttc->IntrEnable & sim_ttc->IntrStatus) && gic_vec[id].enabled && irq_handler != NULL) {
+        irq_pending = id;
+        irq_handler(irq_data);
+    }
+}
+
+static void sim_mask_irq(int how)
+{
+    sigset_t set;
+
+    sigemptyset(&set);
+    sigaddset(&set, SIGALRM);
+    sigprocmask(how, &set, NULL);
+}
+
+void Xil_ExceptionRegisterHandler(u32 Exception_id, Xil_ExceptionHandler Handler, void *Data)
+{
+    struct sigaction sa;
+
+    if (Exception_id != XIL_EXCEPTION_ID_INT) {
+        return;
+    }
+    irq_handler = Handler;
+    irq_data = Data;
+    sa.sa_handler = sim_alarm;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGALRM, &sa, NULL);
+}
+
+void Xil_ExceptionEnable(void)
+{
+    sim_mask_irq(SIG_UNBLOCK);
+}
+
+void Xil_ExceptionDisable(void)
+{
+    sim_mask_irq(SIG_BLOCK);
+}
+
+XScuGic_Config *XScuGic_LookupConfig(u16 DeviceId)
+{
+    return DeviceId == 0 ? &gic_config : NULL;
+}
+
+s32 XScuGic_CfgInitialize(XScuGic *InstancePtr, XScuGic_Config *ConfigPtr, u32 EffectiveAddr)
+{
+    InstancePtr->Config = *ConfigPtr;
+    InstancePtr->Config.CpuBaseAddress = EffectiveAddr;
+    InstancePtr->IsReady = 1;
+    return XST_SUCCESS;
+}
+
+s32 XScuGic_Connect(XScuGic *InstancePtr, u32 Int_Id, Xil_InterruptHandler Handler, void *CallBackRef)
+{
+    (void)InstancePtr;
+    if (Int_Id >= SIM_GIC_IRQS) {
+        return XST_FAILURE;
+    }
+    gic_vec[Int_Id].handler = Handler;
+    gic_vec[Int_Id].ref = CallBackRef;
+    return XST_SUCCESS;
+}
+
+void XScuGic_Enable(XScuGic *InstancePtr, u32 Int_Id)
+{
+    (void)InstancePtr;
+    if (Int_Id < SIM_GIC_IRQS) {
+        gic_vec[Int_Id].enabled = 1;
+    }
+}
+
+void XScuGic_Disable(XScuGic *InstancePtr, u32 Int_Id)
+{
+    (void)InstancePtr;
+    if (Int_Id < SIM_GIC_IRQS) {
+        gic_vec[Int_Id].enabled = 0;
+    }
+}
+
+void XScuGic_InterruptHandler(XScuGic *InstancePtr)
+{
+    u32 id = irq_pending;
+
+    (void)InstancePtr;
+    irq_pending = SIM_GIC_IRQS;
+    if (id < SIM_GIC_IRQS && gic_vec[id].handler != NULL) {
+        gic_vec[id].handler(gic_vec[id].ref);
+    }
+}
+
+XTtcPs_Config *XTtcPs_LookupConfig(u16 DeviceId)
+{
+    return DeviceId == 0 ? &ttc_config : NULL;
+}
+
+s32 XTtcPs_CfgInitialize(XTtcPs *InstancePtr, XTtcPs_Config *ConfigPtr, u32 EffectiveAddr)
+{
+    InstancePtr->Config = *ConfigPtr;
+    InstancePtr->Config.BaseAddress = EffectiveAddr;
+    if (InstancePtr->IsReady && InstancePtr->Started) {
+        return XST_DEVICE_IS_STARTED;
+    }
+    InstancePtr->IsReady = 1;
+    InstancePtr->Options = 0;
+    InstancePtr->Interval = 0xFFFFFFFFU;
+    InstancePtr->Prescaler = XTTCPS_CLK_CNTRL_PS_DISABLE;
+    InstancePtr->IntrEnable = 0;
+    InstancePtr->IntrStatus = 0;
+    sim_ttc = InstancePtr;
+    return XST_SUCCESS;
+}
+
+s32 XTtcPs_SetOptions(XTtcPs *InstancePtr, u32 Options)
+{
+    InstancePtr->Options = Options;
+    return XST_SUCCESS;
+}
+
+void XTtcPs_CalcIntervalFromFreq(XTtcPs *InstancePtr, u32 Freq, XInterval *Interval, u8 *Prescaler)
+{
+    u32 clock = InstancePtr->Config.InputClockHz;
+
+    if (Freq == 0 || clock / Freq < 4) {
+        *Interval = 0xFFFFFFFFU;
+        *Prescaler = 0xFF;
+        return;
+    }
+    *Interval = clock / Freq - 1;
+    *Prescaler = XTTCPS_CLK_CNTRL_PS_DISABLE;
+}
+
+s32 XTtcPs_SetPrescaler(XTtcPs *InstancePtr, u8 PrescalerValue)
+{
+    InstancePtr->Prescaler = PrescalerValue;
+    return XST_SUCCESS;
+}
+
+void XTtcPs_Start(XTtcPs *InstancePtr)
+{
+    struct itimerval it;
+    u64 ticks = (u64)InstancePtr->Interval + 1;
+    u64 us;
+
+    if (InstancePtr->Prescaler < XTTCPS_CLK_CNTRL_PS_DISABLE) {
+        ticks <<= InstancePtr->Prescaler + 1;
+    }
+    us = ticks * 1000000ULL / InstancePtr->Config.InputClockHz;
+    if (us == 0) {
+        us = 1;
+    }
+    it.it_interval.tv_sec = (time_t)(us / 1000000);
+    it.it_interval.tv_usec = (suseconds_t)(us % 1000000);
+    it.it_value = it.it_interval;
+    InstancePtr->Started = 1;
+    setitimer(ITIMER_REAL, &it, NULL);
+}
+
+void XTtcPs_Stop(XTtcPs *InstancePtr)
+{
+    struct itimerval it = { { 0, 0 }, { 0, 0 } };
+
+    setitimer(ITIMER_REAL, &it, NULL);
+    InstancePtr->Started = 0;
+}
+
+void XTtcPs_EnableInterrupts(XTtcPs *InstancePtr, u32 InterruptMask)
+{
+    InstancePtr->IntrEnable |= InterruptMask;
+}
+
+void XTtcPs_DisableInterrupts(XTtcPs *InstancePtr, u32 InterruptMask)
+{
+    InstancePtr->IntrEnable &= ~InterruptMask;
+}
+
+u32 XTtcPs_GetInterruptStatus(XTtcPs *InstancePtr)
+{
+    return InstancePtr->IntrStatus;
+}
+
+void XTtcPs_ClearInterruptStatus(XTtcPs *InstancePtr, u32 InterruptMask)
+{
+    InstancePtr->IntrStatus &= ~InterruptMask;
+}
+
+/*==============================================================================
+ * Xil_In32 / Xil_Out32 dispatch
+ *============================================================================*/
+static void unmapped(const char *op, UINTPTR addr)
+{
+    static int warned;
+
+    if (!warned) {
+        fprintf(stderr, "host_sim: %s to unmapped address 0x%08lX ignored\n",
+                op, (unsigned long)addr);
+        warned = 1;
+    }
+}
+
+u32 host_read32(UINTPTR addr)
+{
+    u32 *w;
+
+    sensor.accesses++;
+
+    if (addr >= SIM_BRAM_BASE && addr < SIM_BRAM_BASE + SIM_BRAM_BYTES) {
+        return bram_read(addr & ~(UINTPTR)3);
+    }
+    if (addr >= SIM_ECC_BASE && addr < SIM_ECC_BASE + SIM_ECC_SPAN) {
+        return ecc_reg_read((u32)(addr - SIM_ECC_BASE));
+    }
+    if (addr == SIM_PL0_REF_CTRL) {
+        return pl0_ref_ctrl;
+    }
+    if (addr == SIM_IOPLL_CTRL || addr == SIM_RPLL_CTRL) {
+        return addr == SIM_IOPLL_CTRL ? iopll_ctrl : rpll_ctrl;
+    }
+    if (addr == SIM_IOPLL_CTRL + 8 || addr == SIM_RPLL_CTRL + 8) {
+        return 0;                   /* *_FRAC_CFG: integer mode */
+    }
+    if ((w = bank_word(addr)) != NULL) {
+        return *w;
+    }
+    if (addr >= SIM_AMS_PS && addr < SIM_AMS_PL + SIM_AMS_SPAN) {
+        return ams_read(addr);
+    }
+    if (BRAM_STREAM_ENABLED && addr >= SIM_STREAM_BASE && addr < SIM_STREAM_BASE + SIM_STREAM_SPAN) {
+        return ingest_reg_read((u32)(addr - SIM_STREAM_BASE) & 0x3CU);
+    }
+#if BRAM_KERNEL_ENABLED
+    if (addr >= SIM_KERNEL_BASE && addr < SIM_KERNEL_BASE + SIM_KERNEL_SPAN) {
+        return kernel_reg_read((u32)(addr - SIM_KERNEL_BASE) & 0x3CU);
+    }
+#endif
+    unmapped("read", addr);
+    return 0;
+}
+
+void host_write32(UINTPTR addr, u32 value)
+{
+    u32 *w;
+
+    sensor.accesses++;
+
+    if (addr >= SIM_BRAM_BASE && addr < SIM_BRAM_BASE + SIM_BRAM_BYTES) {
+        bram_write(addr & ~(UINTPTR)3, value);
+    } else if (addr >= SIM_ECC_BASE && addr < SIM_ECC_BASE + SIM_ECC_SPAN) {
+        ecc_reg_write((u32)(addr - SIM_ECC_BASE), value);
+    } else if (addr == SIM_PL0_REF_CTRL) {
+        pl0_ref_ctrl = value;
+    } else if ((w = bank_word(addr)) != NULL) {
+        *w = value;
+    } else if (BRAM_STREAM_ENABLED && addr >= SIM_STREAM_BASE &&
+               addr < SIM_STREAM_BASE + SIM_STREAM_SPAN) {
+        ingest_reg_write((u32)(addr - SIM_STREAM_BASE) & 0x3CU, value);
+#if BRAM_KERNEL_ENABLED
+    } else if (addr >= SIM_KERNEL_BASE && addr < SIM_KERNEL_BASE + SIM_KERNEL_SPAN) {
+        kernel_reg_write((u32)(addr - SIM_KERNEL_BASE) & 0x3CU, value);
+#endif
+    } else {
+        unmapped("write", addr);
+    }
+}
+
+u32 host_read_narrow(UINTPTR addr, u32 size)
+{
+    u32 shift = (u32)(addr & 3U) * 8;
+    u32 mask = (size == 1) ? 0xFFU : 0xFFFFU;
+
+    return (host_read32(addr & ~(UINTPTR)3) >> shift) & mask;
+}
+
+void host_write_narrow(UINTPTR addr, u32 value, u32 size)
+{
+    u32 lane = (u32)(addr & 3U);
+    u32 strb = ((size == 1) ? 0x1U : 0x3U) << lane;
+    u32 mask = ((size == 1) ? 0xFFU : 0xFFFFU) << (lane * 8);
+    u32 *w;
+
+    sensor.accesses++;
+
+    if (addr >= SIM_BRAM_BASE && addr < SIM_BRAM_BASE + SIM_BRAM_BYTES) {
+        bram_write_strb(addr & ~(UINTPTR)3, value << (lane * 8), strb);
+    } else if ((w = bank_word(addr)) != NULL) {
+        *w = (*w & ~mask) | ((value << (lane * 8)) & mask);
+    } else {
+        unmapped("narrow write", addr);
+    }
+}
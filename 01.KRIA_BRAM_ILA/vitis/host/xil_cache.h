@@ -0,0 +1,17 @@
+/*==============================================================================
+ * Host stub - xil_cache.h
+ *
+ * The host is cache coherent; maintenance operations are no-ops.
+ *============================================================================*/
+#ifndef HOST_XIL_CACHE_H
+#define HOST_XIL_CACHE_H
+
+#include "xil_types.h"
+
+static inline void Xil_DCacheEnable(void) {}
+static inline void Xil_DCacheDisable(void) {}
+static inline void Xil_DCacheFlushRange(UINTPTR adr, u32 len) { (void)adr; (void)len; }
+static inline void Xil_DCacheInvalidateRange(UINTPTR adr, u32 len) { (void)adr; (void)len; }
+static inline void Xil_ICacheInvalidate(void) {}
+
+#endif /* HOST_XIL_CACHE_H */
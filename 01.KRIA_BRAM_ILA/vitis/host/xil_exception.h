@@ -0,0 +1,22 @@
+/*==============================================================================
+ * Host stub - xil_exception.h
+ *
+ * The IRQ exception is the SIGALRM handler in host_sim.c; masking IRQs
+ * blocks the signal.
+ *============================================================================*/
+#ifndef HOST_XIL_EXCEPTION_H
+#define HOST_XIL_EXCEPTION_H
+
+#include "xil_types.h"
+
+#define XIL_EXCEPTION_ID_INT    5U
+
+typedef void (*Xil_ExceptionHandler)(void *data);
+typedef void (*Xil_InterruptHandler)(void *data);
+
+static inline void Xil_ExceptionInit(void) {}
+void Xil_ExceptionRegisterHandler(u32 Exception_id, Xil_ExceptionHandler Handler, void *Data);
+void Xil_ExceptionEnable(void);
+void Xil_ExceptionDisable(void);
+
+#endif /* HOST_XIL_EXCEPTION_H */
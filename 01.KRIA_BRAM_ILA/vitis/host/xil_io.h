@@ -0,0 +1,49 @@
+/*==============================================================================
+ * Host stub - xil_io.h
+ *
+ * Register and BRAM accesses go through host_sim.c, which maps the BRAM
+ * window at its board address and models the PS/PL registers the app uses.
+ *============================================================================*/
+#ifndef HOST_XIL_IO_H
+#define HOST_XIL_IO_H
+
+#include "xil_types.h"
+
+u32 host_read32(UINTPTR addr);
+void host_write32(UINTPTR addr, u32 value);
+
+/* Narrow accesses: size is 1 or 2 bytes, addr naturally aligned */
+u32 host_read_narrow(UINTPTR addr, u32 size);
+void host_write_narrow(UINTPTR addr, u32 value, u32 size);
+
+static inline u8 Xil_In8(UINTPTR Addr)
+{
+    return (u8)host_read_narrow(Addr, 1);
+}
+
+static inline u16 Xil_In16(UINTPTR Addr)
+{
+    return (u16)host_read_narrow(Addr, 2);
+}
+
+static inline void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+    host_write_narrow(Addr, Value, 1);
+}
+
+static inline void Xil_Out16(UINTPTR Addr, u16 Value)
+{
+    host_write_narrow(Addr, Value, 2);
+}
+
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+    return host_read32(Addr);
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+    host_write32(Addr, Value);
+}
+
+#endif /* HOST_XIL_IO_H */
@@ -0,0 +1,18 @@
+/*==============================================================================
+ * Host stub - xil_mmu.h
+ *============================================================================*/
+#ifndef HOST_XIL_MMU_H
+#define HOST_XIL_MMU_H
+
+#include "xil_types.h"
+
+#define NORM_WB_CACHE   0x705U
+#define DEVICE_MEMORY   0x409U
+
+static inline void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib)
+{
+    (void)Addr;
+    (void)attrib;
+}
+
+#endif /* HOST_XIL_MMU_H */
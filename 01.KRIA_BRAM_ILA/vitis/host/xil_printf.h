@@ -0,0 +1,31 @@
+/*==============================================================================
+ * Host stub - xil_printf.h
+ *
+ * The menu has no quit key on UART, so end of input exits the program.
+ *============================================================================*/
+#ifndef HOST_XIL_PRINTF_H
+#define HOST_XIL_PRINTF_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define xil_printf  printf
+
+static inline char inbyte(void)
+{
+    int c;
+
+    fflush(stdout);
+    c = getchar();
+    if (c == EOF) {
+        exit(0);
+    }
+    return (char)c;
+}
+
+static inline void outbyte(char c)
+{
+    putchar(c);
+}
+
+#endif /* HOST_XIL_PRINTF_H */
@@ -0,0 +1,23 @@
+/*==============================================================================
+ * Host stub - xil_types.h
+ *
+ * Minimal replacement for the Xilinx standalone BSP so the BRAM test app
+ * can be compiled and run on a Linux host without a board.
+ *============================================================================*/
+#ifndef HOST_XIL_TYPES_H
+#define HOST_XIL_TYPES_H
+
+#include <stdint.h>
+
+typedef uint8_t   u8;
+typedef uint16_t  u16;
+typedef uint32_t  u32;
+typedef uint64_t  u64;
+typedef int32_t   s32;
+typedef int64_t   s64;
+typedef uintptr_t UINTPTR;
+
+#define XST_SUCCESS     0L
+#define XST_FAILURE     1L
+
+#endif /* HOST_XIL_TYPES_H */
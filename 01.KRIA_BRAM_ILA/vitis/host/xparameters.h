@@ -0,0 +1,18 @@
+/*==============================================================================
+ * Host stub - xparameters.h
+ *
+ * Addresses match create_project.tcl. BRAM_ECC_ENABLED is left to the
+ * command line (-DBRAM_ECC_ENABLED=1) as on the board.
+ *============================================================================*/
+#ifndef HOST_XPARAMETERS_H
+#define HOST_XPARAMETERS_H
+
+#define XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR         0x80000000U
+#define XPAR_AXI_BRAM_CTRL_0_S_AXI_CTRL_BASEADDR    0x80200000U
+#define XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ        1333333008U
+
+#define XPAR_SCUGIC_SINGLE_DEVICE_ID                0U
+#define XPAR_XTTCPS_0_DEVICE_ID                     0U
+#define XPAR_XTTCPS_0_INTR                          68U
+
+#endif /* HOST_XPARAMETERS_H */
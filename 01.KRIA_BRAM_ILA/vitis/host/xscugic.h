@@ -0,0 +1,37 @@
+/*==============================================================================
+ * Host stub - xscugic.h
+ *
+ * One handler per interrupt ID; only the TTC interval interrupt of
+ * host_sim.c is ever raised.
+ *============================================================================*/
+#ifndef HOST_XSCUGIC_H
+#define HOST_XSCUGIC_H
+
+#include "xil_types.h"
+#include "xil_exception.h"
+
+typedef struct {
+    u16 DeviceId;
+    UINTPTR CpuBaseAddress;
+    UINTPTR DistBaseAddress;
+} XScuGic_Config;
+
+typedef struct {
+    XScuGic_Config Config;
+    u32 IsReady;
+} XScuGic;
+
+XScuGic_Config *XScuGic_LookupConfig(u16 DeviceId);
+s32 XScuGic_CfgInitialize(XScuGic *InstancePtr, XScuGic_Config *ConfigPtr, u32 EffectiveAddr);
+s32 XScuGic_Connect(XScuGic *InstancePtr, u32 Int_Id, Xil_InterruptHandler Handler, void *CallBackRef);
+void XScuGic_Enable(XScuGic *InstancePtr, u32 Int_Id);
+void XScuGic_Disable(XScuGic *InstancePtr, u32 Int_Id);
+void XScuGic_InterruptHandler(XScuGic *InstancePtr);
+
+static inline void XScuGic_SetPriorityTriggerType(XScuGic *InstancePtr, u32 Int_Id,
+                                                  u8 Priority, u8 Trigger)
+{
+    (void)InstancePtr; (void)Int_Id; (void)Priority; (void)Trigger;
+}
+
+#endif /* HOST_XSCUGIC_H */
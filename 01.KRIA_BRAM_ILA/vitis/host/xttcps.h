@@ -0,0 +1,61 @@
+/*==============================================================================
+ * Host stub - xttcps.h
+ *
+ * Interval mode only: XTtcPs_Start arms a setitimer(ITIMER_REAL) with the
+ * programmed interval, each expiry raises the interval interrupt through
+ * the GIC stub (SIGALRM, see host_sim.c).
+ *============================================================================*/
+#ifndef HOST_XTTCPS_H
+#define HOST_XTTCPS_H
+
+#include "xil_types.h"
+
+#define XST_DEVICE_IS_STARTED           5L
+
+#define XTTCPS_OPTION_INTERVAL_MODE     0x00000002U
+#define XTTCPS_OPTION_WAVE_DISABLE      0x00000020U
+#define XTTCPS_IXR_INTERVAL_MASK        0x00000001U
+#define XTTCPS_CLK_CNTRL_PS_DISABLE     16U
+
+typedef u32 XInterval;
+
+typedef struct {
+    u16 DeviceId;
+    u32 BaseAddress;
+    u32 InputClockHz;
+} XTtcPs_Config;
+
+typedef struct {
+    XTtcPs_Config Config;
+    u32 IsReady;
+    u32 Options;
+    XInterval Interval;
+    u8 Prescaler;
+    u32 IntrEnable;
+    u32 IntrStatus;
+    u32 Started;
+} XTtcPs;
+
+XTtcPs_Config *XTtcPs_LookupConfig(u16 DeviceId);
+s32 XTtcPs_CfgInitialize(XTtcPs *InstancePtr, XTtcPs_Config *ConfigPtr, u32 EffectiveAddr);
+s32 XTtcPs_SetOptions(XTtcPs *InstancePtr, u32 Options);
+void XTtcPs_CalcIntervalFromFreq(XTtcPs *InstancePtr, u32 Freq, XInterval *Interval, u8 *Prescaler);
+s32 XTtcPs_SetPrescaler(XTtcPs *InstancePtr, u8 PrescalerValue);
+void XTtcPs_Start(XTtcPs *InstancePtr);
+void XTtcPs_Stop(XTtcPs *InstancePtr);
+void XTtcPs_EnableInterrupts(XTtcPs *InstancePtr, u32 InterruptMask);
+void XTtcPs_DisableInterrupts(XTtcPs *InstancePtr, u32 InterruptMask);
+u32 XTtcPs_GetInterruptStatus(XTtcPs *InstancePtr);
+void XTtcPs_ClearInterruptStatus(XTtcPs *InstancePtr, u32 InterruptMask);
+
+static inline void XTtcPs_SetInterval(XTtcPs *InstancePtr, XInterval Value)
+{
+    InstancePtr->Interval = Value;
+}
+
+static inline void XTtcPs_ResetCounterValue(XTtcPs *InstancePtr)
+{
+    (void)InstancePtr;
+}
+
+#endif /* HOST_XTTCPS_H */
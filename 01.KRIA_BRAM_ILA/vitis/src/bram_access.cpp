@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 템플릿 액세스 계층 C shim
+ *
+ * File: bram_access.cpp
+ * Description: bram_test.h의 기본 액세스 함수를 bram_access.hpp 템플릿으로 구현
+ *              (BRAM_ACCESS_CPP 정의 시 main.c 구현 대신 사용)
+ *              및 BRAM 영역 캐시 속성 전환
+ ******************************************************************************/
+
+extern "C" {
+#include "xil_cache.h"
+#include "xil_mmu.h"
+}
+
+#include "bram_access.hpp"
+#include "bram_access.h"
+
+/**
+ * @brief BRAM 영역 캐시 속성 전환
+ * @param enable 1: Normal WB 매핑 + D-Cache 활성화, 0: Device 매핑 + D-Cache 비활성화
+ *
+ * main()은 ILA 디버깅을 위해 D-Cache를 끈 상태로 동작하므로
+ * Cached 정책 측정이 끝나면 반드시 0으로 되돌립니다.
+ * A53 변환 테이블은 4GB 이하를 2MB 블록으로 매핑하므로
+ * 0x80000000~0x801FFFFF 블록 전체의 속성이 바뀝니다. 이 블록에는 BRAM만 두고
+ * ECC / stream / 커널 레지스터는 0x80200000 블록에 배치합니다
+ * (bram_test.h에서 컴파일 시 검사).
+ */
+void bram_access_set_cached(int enable)
+{
+    if (enable) {
+        Xil_SetTlbAttributes(BRAM_BASE_ADDR, NORM_WB_CACHE);
+        Xil_DCacheEnable();
+    } else {
+        Xil_DCacheDisable();
+        Xil_SetTlbAttributes(BRAM_BASE_ADDR, DEVICE_MEMORY);
+    }
+}
+
+#ifdef BRAM_ACCESS_CPP
+
+extern "C" void bram_write_single(u32 offset, u32 data)
+{
+    bram::Bram32::write(offset, data);
+}
+
+extern "C" u32 bram_read_single(u32 offset)
+{
+    return bram::Bram32::read(offset);
+}
+
+extern "C" void bram_write_multiple(u32 start_offset, u32 *data, u32 count)
+{
+    bram::Bram32::write_n(start_offset, data, count);
+}
+
+extern "C" void bram_read_multiple(u32 start_offset, u32 *data, u32 count)
+{
+    bram::Bram32::read_n(start_offset, data, count);
+}
+
+extern "C" void bram_fill_all(u32 value)
+{
+    bram::Bram32::fill(value);
+}
+
+#endif /* BRAM_ACCESS_CPP */
@@ -0,0 +1,31 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 템플릿 액세스 계층 C 인터페이스
+ *
+ * File: bram_access.h
+ * Description: bram_access.hpp(C++)를 C 코드에서 사용하기 위한 선언
+ *
+ * BRAM_ACCESS_CPP 를 정의하고 빌드하면 bram_test.h의 기본 액세스 함수
+ * (bram_write_single, bram_write_multiple, ...)가 main.c 대신
+ * bram_access.cpp의 템플릿 구현으로 연결됩니다.
+ ******************************************************************************/
+
+#ifndef BRAM_ACCESS_H
+#define BRAM_ACCESS_H
+
+#include "xil_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* BRAM 영역 매핑 전환: 1 = Normal WB + D-Cache on, 0 = Device + D-Cache off */
+void bram_access_set_cached(int enable);
+
+/* 액세스 커널 벤치마크 (메뉴 14) */
+void test_access_bench(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BRAM_ACCESS_H */
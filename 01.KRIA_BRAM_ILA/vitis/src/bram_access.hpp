@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 컴파일 타임 특수화 액세스 계층 (C++)
+ *
+ * File: bram_access.hpp
+ * Description: 베이스 주소, 액세스 폭(32/64/128), 액세스 정책(Device/Cached)을
+ *              템플릿 인자로 받아 컴파일 타임에 주소 계산과 루프 펼침을 끝낸
+ *              직선(straight-line) load/store 코드를 생성
+ *
+ * main.c의 bram_write_multiple은 워드마다 BRAM_BASE_ADDR + offset * 4를 계산하고
+ * Xil_Out32를 호출합니다. 여기서는 베이스가 상수이고 포인터만 증가하며
+ * 8워드 단위로 펼쳐진 본문을 사용합니다.
+ *
+ * 사용 예:
+ *   typedef bram::Bram<BRAM_BASE_ADDR, 64, bram::Device> B64;
+ *   B64::write_block<4>(0, src);        // 64비트 store 4개, 루프 없음
+ *   B64::fill(0);                       // 전체 BRAM, 8 x 64비트 단위 펼침
+ ******************************************************************************/
+
+#ifndef BRAM_ACCESS_HPP
+#define BRAM_ACCESS_HPP
+
+extern "C" {
+#include "xil_types.h"
+#include "xil_cache.h"
+#include "bram_test.h"
+}
+
+namespace bram {
+
+/*******************************************************************************
+ * 워드 타입
+ ******************************************************************************/
+/* 128비트 워드: AArch64에서 64비트 load/store 한 쌍 (LDP/STP) */
+struct u128 {
+    u64 lo;
+    u64 hi;
+};
+
+template <unsigned Width> struct word_of;
+template <> struct word_of<32>  { typedef u32  type; };
+template <> struct word_of<64>  { typedef u64  type; };
+template <> struct word_of<128> { typedef u128 type; };
+
+/*******************************************************************************
+ * 액세스 정책
+ ******************************************************************************/
+/* Device: volatile 액세스, 모든 load/store가 그대로 AXI 트랜잭션이 됨 (ILA로 관찰 가능) */
+struct Device {
+    static const bool cached = false;
+
+    template <typename T>
+    static inline T load(UINTPTR addr)
+    {
+        return *reinterpret_cast<const volatile T *>(addr);
+    }
+    template <typename T>
+    static inline void store(UINTPTR addr, T value)
+    {
+        *reinterpret_cast<volatile T *>(addr) = value;
+    }
+    static inline void publish(UINTPTR, u32) {}
+    static inline void refresh(UINTPTR, u32) {}
+};
+
+template <>
+inline u128 Device::load<u128>(UINTPTR addr)
+{
+    const volatile u64 *p = reinterpret_cast<const volatile u64 *>(addr);
+    u128 v;
+    v.lo = p[0];
+    v.hi = p[1];
+    return v;
+}
+
+template <>
+inline void Device::store<u128>(UINTPTR addr, u128 value)
+{
+    volatile u64 *p = reinterpret_cast<volatile u64 *>(addr);
+    p[0] = value.lo;
+    p[1] = value.hi;
+}
+
+/*
+ * Cached: 일반 메모리 액세스 (컴파일러가 합치고 재배치 가능)
+ * BRAM 영역이 Normal WB로 매핑되고 D-Cache가 켜져 있어야 합니다
+ * (bram_access_set_cached(1)). 쓰기 후 publish로 flush, 읽기 전 refresh로 invalidate.
+ */
+struct Cached {
+    static const bool cached = true;
+
+    template <typename T>
+    static inline T load(UINTPTR addr)
+    {
+        return *reinterpret_cast<const T *>(addr);
+    }
+    template <typename T>
+    static inline void store(UINTPTR addr, T value)
+    {
+        *reinterpret_cast<T *>(addr) = value;
+    }
+    static inline void publish(UINTPTR addr, u32 bytes)
+    {
+        Xil_DCacheFlushRange(addr, bytes);
+    }
+    static inline void refresh(UINTPTR addr, u32 bytes)
+    {
+        Xil_DCacheInvalidateRange(addr, bytes);
+    }
+};
+
+/*******************************************************************************
+ * 컴파일 타임 루프 펼침
+ ******************************************************************************/
+template <u32 N>
+struct Unroll {
+    template <class P, typename T>
+    static inline void store(UINTPTR addr, const T *src)
+    {
+        Unroll<N - 1>::template store<P, T>(addr, src);
+        P::template store<T>(addr + (N - 1) * sizeof(T), src[N - 1]);
+    }
+    template <class P, typename T>
+    static inline void load(UINTPTR addr, T *dst)
+    {
+        Unroll<N - 1>::template load<P, T>(addr, dst);
+        dst[N - 1] = P::template load<T>(addr + (N - 1) * sizeof(T));
+    }
+    template <class P, typename T>
+    static inline void fill(UINTPTR addr, T value)
+    {
+        Unroll<N - 1>::template fill<P, T>(addr, value);
+        P::template store<T>(addr + (N - 1) * sizeof(T), value);
+    }
+};
+
+template <>
+struct Unroll<0> {
+    template <class P, typename T> static inline void store(UINTPTR, const T *) {}
+    template <class P, typename T> static inline void load(UINTPTR, T *) {}
+    template <class P, typename T> static inline void fill(UINTPTR, T) {}
+};
+
+/*******************************************************************************
+ * BRAM 액세스 템플릿
+ ******************************************************************************/
+template <UINTPTR Base, unsigned Width = 32, class Policy = Device>
+struct Bram {
+    typedef typename word_of<Width>::type word_t;
+
+    static const u32 word_bytes = Width / 8;
+    static const u32 words = BRAM_SIZE_BYTES / word_bytes;
+    static const u32 unroll = 8;        /* 런타임 개수 루프의 펼침 단위 */
+
+    static inline UINTPTR addr(u32 index)
+    {
+        return Base + (UINTPTR)index * word_bytes;
+    }
+
+    /* 단일 워드 */
+    static inline void write(u32 index, word_t value)
+    {
+        Policy::template store<word_t>(addr(index), value);
+        Policy::publish(addr(index), word_bytes);
+    }
+    static inline word_t read(u32 index)
+    {
+        Policy::refresh(addr(index), word_bytes);
+        return Policy::template load<word_t>(addr(index));
+    }
+
+    /* 컴파일 타임 개수: 루프 없이 Count개의 load/store */
+    template <u32 Count>
+    static inline void write_block(u32 start, const word_t *src)
+    {
+        static_assert(Count <= 64, "use write_n for large blocks");
+        Unroll<Count>::template store<Policy, word_t>(addr(start), src);
+        Policy::publish(addr(start), Count * word_bytes);
+    }
+    template <u32 Count>
+    static inline void read_block(u32 start, word_t *dst)
+    {
+        static_assert(Count <= 64, "use read_n for large blocks");
+        Policy::refresh(addr(start), Count * word_bytes);
+        Unroll<Count>::template load<Policy, word_t>(addr(start), dst);
+    }
+
+    /* 런타임 개수: 8워드 펼침 본문 + 나머지 */
+    static inline void write_n(u32 start, const word_t *src, u32 count)
+    {
+        UINTPTR a = addr(start);
+        u32 i = 0;
+
+        for (; i + unroll <= count; i += unroll, a += unroll * word_bytes) {
+            Unroll<unroll>::template store<Policy, word_t>(a, src + i);
+        }
+        for (; i < count; i++, a += word_bytes) {
+            Policy::template store<word_t>(a, src[i]);
+        }
+        Policy::publish(addr(start), count * word_bytes);
+    }
+    static inline void read_n(u32 start, word_t *dst, u32 count)
+    {
+        UINTPTR a = addr(start);
+        u32 i = 0;
+
+        Policy::refresh(addr(start), count * word_bytes);
+        for (; i + unroll <= count; i += unroll, a += unroll * word_bytes) {
+            Unroll<unroll>::template load<Policy, word_t>(a, dst + i);
+        }
+        for (; i < count; i++, a += word_bytes) {
+            dst[i] = Policy::template load<word_t>(a);
+        }
+    }
+
+    /* 전체 BRAM 채우기 (반복 횟수가 컴파일 타임 상수) */
+    static inline void fill(word_t value)
+    {
+        UINTPTR a = Base;
+        u32 i;
+
+        for (i = 0; i < words; i += unroll, a += unroll * word_bytes) {
+            Unroll<unroll>::template fill<Policy, word_t>(a, value);
+        }
+        Policy::publish(Base, BRAM_SIZE_BYTES);
+    }
+};
+
+/* 기본 BRAM (axi_bram_ctrl_0) */
+typedef Bram<BRAM_BASE_ADDR, 32, Device> Bram32;
+
+} /* namespace bram */
+
+#endif /* BRAM_ACCESS_HPP */
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 액세스 커널 벤치마크
+ *
+ * File: bram_access_bench.cpp
+ * Description: 기존 C 액세스 루프와 bram_access.hpp 템플릿 커널의
+ *              32비트 워드당 CPU 사이클과 처리량 비교
+ ******************************************************************************/
+
+extern "C" {
+#include "xil_printf.h"
+#include "bram_bench.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+}
+
+#include "bram_access.hpp"
+#include "bram_access.h"
+
+#define ACCESS_BENCH_ROUNDS     64
+
+typedef struct {
+    u32 write_cyc_x100;
+    u32 read_cyc_x100;
+    u32 write_mbps_x100;
+    u32 read_mbps_x100;
+    u32 errors;
+} access_result_t;
+
+/* DDR 원본/결과 버퍼 (128비트 정렬) */
+static bram::u128 src_buf[BRAM_SIZE_BYTES / 16];
+static bram::u128 dst_buf[BRAM_SIZE_BYTES / 16];
+
+static void fill_source(u32 seed)
+{
+    u32 *p = reinterpret_cast<u32 *>(src_buf);
+    u32 i;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        p[i] = (i * 0x9E3779B9U) ^ seed;
+    }
+}
+
+static u32 compare_buffers(void)
+{
+    const u32 *a = reinterpret_cast<const u32 *>(src_buf);
+    const u32 *b = reinterpret_cast<const u32 *>(dst_buf);
+    u32 i, errors = 0;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        if (a[i] != b[i]) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+static void finish_result(access_result_t *r, XTime t_write, XTime t_read)
+{
+    u32 words = ACCESS_BENCH_ROUNDS * BRAM_SIZE_WORDS;
+    u32 bytes = ACCESS_BENCH_ROUNDS * BRAM_SIZE_BYTES;
+
+    r->write_cyc_x100 = bench_cycles_per_word_x100(t_write, words);
+    r->read_cyc_x100 = bench_cycles_per_word_x100(t_read, words);
+    r->write_mbps_x100 = bench_mbps_x100(bytes, t_write);
+    r->read_mbps_x100 = bench_mbps_x100(bytes, t_read);
+    r->errors = compare_buffers();
+}
+
+/*******************************************************************************
+ * 측정 대상
+ ******************************************************************************/
+/**
+ * @brief 기존 방식: 워드마다 bram_write_single / bram_read_single 호출
+ */
+static void measure_single_calls(access_result_t *r)
+{
+    u32 *src = reinterpret_cast<u32 *>(src_buf);
+    u32 *dst = reinterpret_cast<u32 *>(dst_buf);
+    XTime t0, t_write, t_read;
+    u32 round, i;
+
+    t0 = bench_now();
+    for (round = 0; round < ACCESS_BENCH_ROUNDS; round++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            bram_write_single(i, src[i]);
+        }
+    }
+    t_write = bench_now() - t0;
+
+    t0 = bench_now();
+    for (round = 0; round < ACCESS_BENCH_ROUNDS; round++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            dst[i] = bram_read_single(i);
+        }
+    }
+    t_read = bench_now() - t0;
+
+    finish_result(r, t_write, t_read);
+}
+
+/**
+ * @brief C API: bram_write_multiple / bram_read_multiple
+ *        (BRAM_ACCESS_CPP 빌드에서는 템플릿 shim)
+ */
+static void measure_multiple(access_result_t *r)
+{
+    u32 *src = reinterpret_cast<u32 *>(src_buf);
+    u32 *dst = reinterpret_cast<u32 *>(dst_buf);
+    XTime t0, t_write, t_read;
+    u32 round;
+
+    t0 = bench_now();
+    for (round = 0; round < ACCESS_BENCH_ROUNDS; round++) {
+        bram_write_multiple(0, src, BRAM_SIZE_WORDS);
+    }
+    t_write = bench_now() - t0;
+
+    t0 = bench_now();
+    for (round = 0; round < ACCESS_BENCH_ROUNDS; round++) {
+        bram_read_multiple(0, dst, BRAM_SIZE_WORDS);
+    }
+    t_read = bench_now() - t0;
+
+    finish_result(r, t_write, t_read);
+}
+
+/**
+ * @brief 템플릿 커널 (폭/정책별로 인스턴스화)
+ */
+template <class B>
+static void measure_template(access_result_t *r)
+{
+    typedef typename B::word_t word_t;
+    const word_t *src = reinterpret_cast<const word_t *>(src_buf);
+    word_t *dst = reinterpret_cast<word_t *>(dst_buf);
+    XTime t0, t_write, t_read;
+    u32 round;
+
+    t0 = bench_now();
+    for (round = 0; round < ACCESS_BENCH_ROUNDS; round++) {
+        B::write_n(0, src, B::words);
+    }
+    t_write = bench_now() - t0;
+
+    t0 = bench_now();
+    for (round = 0; round < ACCESS_BENCH_ROUNDS; round++) {
+        B::read_n(0, dst, B::words);
+    }
+    t_read = bench_now() - t0;
+
+    finish_result(r, t_write, t_read);
+}
+
+static void print_x100_padded(u32 value_x100)
+{
+    xil_printf("%6d.%02d", value_x100 / 100, value_x100 % 100);
+}
+
+static void print_row(const char *name, const access_result_t *r,
+                      u32 width, int cached, const bench_latency_t *lat = NULL)
+{
+    xil_printf("%-26s", name);
+    print_x100_padded(r->write_cyc_x100);
+    print_x100_padded(r->read_cyc_x100);
+    xil_printf(" ");
+    print_x100_padded(r->write_mbps_x100);
+    print_x100_padded(r->read_mbps_x100);
+    xil_printf("  %s\r\n", r->errors == 0 ? "OK" : "ERR");
+
+    bench_result_add(name, width, cached, r->write_mbps_x100, r->read_mbps_x100, lat);
+}
+
+/*******************************************************************************
+ * 메뉴 14
+ ******************************************************************************/
+/**
+ * @brief 액세스 커널 벤치마크
+ *
+ * 사이클은 글로벌 타이머 틱을 BENCH_CPU_HZ로 환산한 값이며,
+ * 모든 행은 32비트 워드 기준 (64/128비트 폭은 워드 수로 나눔)입니다.
+ */
+void test_access_bench(void)
+{
+    typedef bram::Bram<BRAM_BASE_ADDR, 32, bram::Device> Dev32;
+    typedef bram::Bram<BRAM_BASE_ADDR, 64, bram::Device> Dev64;
+    typedef bram::Bram<BRAM_BASE_ADDR, 128, bram::Device> Dev128;
+    typedef bram::Bram<BRAM_BASE_ADDR, 32, bram::Cached> Wb32;
+    typedef bram::Bram<BRAM_BASE_ADDR, 64, bram::Cached> Wb64;
+    typedef bram::Bram<BRAM_BASE_ADDR, 128, bram::Cached> Wb128;
+    access_result_t r;
+    bench_latency_t lat;
+
+    xil_printf("=== Access Kernel Benchmark ===\r\n");
+    xil_printf("%d rounds x %d KB, CPU %d MHz, cycles per 32-bit word\r\n",
+               ACCESS_BENCH_ROUNDS, BRAM_SIZE_BYTES / 1024, BENCH_CPU_HZ / 1000000);
+#ifdef BRAM_ACCESS_CPP
+    xil_printf("C API: template shim (BRAM_ACCESS_CPP)\r\n");
+#else
+    xil_printf("C API: main.c loops\r\n");
+#endif
+    xil_printf("\r\n");
+    xil_printf("Kernel                     Wr cyc/w  Rd cyc/w    Wr MB/s   Rd MB/s  Check\r\n");
+    xil_printf("-------------------------- --------- ---------  --------- ---------  -----\r\n");
+
+    fill_source(0x1234ABCD);
+    bench_result_begin("access");
+
+    measure_single_calls(&r);
+    bench_read_latency(&lat);
+    print_row("bram_*_single per word", &r, 32, 0, &lat);
+    measure_multiple(&r);
+    print_row("bram_*_multiple", &r, 32, 0);
+
+    measure_template<Dev32>(&r);
+    print_row("Bram<32, Device>", &r, 32, 0);
+    measure_template<Dev64>(&r);
+    print_row("Bram<64, Device>", &r, 64, 0);
+    measure_template<Dev128>(&r);
+    print_row("Bram<128, Device>", &r, 128, 0);
+
+    /* Cached 정책: 쓰기 후 flush, 읽기 전 invalidate 시간 포함 */
+    bram_access_set_cached(1);
+    measure_template<Wb32>(&r);
+    print_row("Bram<32, Cached>", &r, 32, 1);
+    measure_template<Wb64>(&r);
+    print_row("Bram<64, Cached>", &r, 64, 1);
+    measure_template<Wb128>(&r);
+    print_row("Bram<128, Cached>", &r, 128, 1);
+    bram_access_set_cached(0);
+
+    xil_printf("\r\nD-Cache disabled, BRAM mapped as Device again\r\n");
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Headless Autorun
+ *
+ * File: bram_autorun.c
+ * Description: 양산 자가 테스트용 무인 실행 시퀀스
+ *
+ * 출력은 마지막 한 줄뿐입니다 (AUTORUN_MATRIX를 켜면 그 앞에 "matrix" @BENCH 레코드):
+ *   @SELFTEST {"build":"1a2b3c4","result":"PASS","tests":"0x1F","fail":"0x00",
+ *              "boot_us":812345,"run_us":2150,"reset_to_result_us":814495,
+ *              "pattern_us":310,...,"wr_mbps":45.12,"rd_mbps":20.03}
+ *
+ * boot_us는 main() 진입 시 글로벌 타이머 값입니다. 시스템 카운터는 FSBL이
+ * 시작하므로 CSU/PMU ROM 구간은 포함되지 않으며, JTAG로 다시 올린 경우에는
+ * 이전 부팅부터 누적된 값이 됩니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_byte.h"
+#include "bram_ecc.h"
+#include "bram_result.h"
+#include "bram_matrix.h"
+#include "bram_autorun.h"
+
+typedef struct {
+    u32 bit;
+    const char *name;
+    u32 (*run)(void);       /* 반환: 오류 수 */
+} autorun_test_t;
+
+static bench_throughput_t autorun_tp;
+
+/*******************************************************************************
+ * 테스트
+ ******************************************************************************/
+static u32 fill_and_check(u32 value)
+{
+    u32 i, errors = 0;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        Xil_Out32(BRAM_BASE_ADDR + (i * 4), value);
+    }
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        if (Xil_In32(BRAM_BASE_ADDR + (i * 4)) != value) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+static u32 run_pattern(void)
+{
+    return fill_and_check(0x00000000) + fill_and_check(0xFFFFFFFF) +
+           fill_and_check(0x55AA55AA) + fill_and_check(0xAA55AA55);
+}
+
+/**
+ * @brief 각 워드에 자기 주소와 그 보수를 차례로 기록 → 주소선 단락/중복 검출
+ */
+static u32 run_address(void)
+{
+    u32 i, pass, value, errors = 0;
+
+    for (pass = 0; pass < 2; pass++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            value = BRAM_BASE_ADDR + (i * 4);
+            Xil_Out32(BRAM_BASE_ADDR + (i * 4), pass ? ~value : value);
+        }
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            value = BRAM_BASE_ADDR + (i * 4);
+            if (Xil_In32(BRAM_BASE_ADDR + (i * 4)) != (pass ? ~value : value)) {
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief 한 워드에서 walking 1 / walking 0 → 데이터선 고착/단락 검출
+ */
+static u32 run_databus(void)
+{
+    u32 bit, errors = 0;
+
+    for (bit = 0; bit < 32; bit++) {
+        Xil_Out32(BRAM_BASE_ADDR, 1U << bit);
+        if (Xil_In32(BRAM_BASE_ADDR) != (1U << bit)) {
+            errors++;
+        }
+        Xil_Out32(BRAM_BASE_ADDR, ~(1U << bit));
+        if (Xil_In32(BRAM_BASE_ADDR) != ~(1U << bit)) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief 8비트 쓰기가 다른 레인을 건드리지 않는지 (첫/마지막 워드)
+ */
+static u32 run_byte_lanes(void)
+{
+    static const u32 words[] = {0, BRAM_MAX_OFFSET};
+    u32 w, lane, expect, errors = 0;
+
+    for (w = 0; w < 2; w++) {
+        for (lane = 0; lane < 4; lane++) {
+            Xil_Out32(BRAM_BASE_ADDR + words[w] * 4, 0xFFFFFFFF);
+            bram_write8(words[w] * 4 + lane, 0x00);
+            expect = ~(0xFFU << (lane * 8));
+            if (Xil_In32(BRAM_BASE_ADDR + words[w] * 4) != expect) {
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+static u32 run_throughput(void)
+{
+    bench_bram_throughput(&autorun_tp, AUTORUN_THROUGHPUT_ROUNDS);
+#if BRAM_AUTORUN_MIN_MBPS > 0
+    if (autorun_tp.write_mbps_x100 < BRAM_AUTORUN_MIN_MBPS * 100U ||
+        autorun_tp.read_mbps_x100 < BRAM_AUTORUN_MIN_MBPS * 100U) {
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief 단일 비트는 정정(CE), 이중 비트는 검출(UE)되는지
+ */
+static u32 run_ecc(void)
+{
+    u32 errors = 0;
+
+    ecc_set_checking(1);
+    ecc_clear_status();
+    ecc_inject(0, 0x12345678, 1U << 3, 0);
+    if (Xil_In32(BRAM_BASE_ADDR) != 0x12345678 || ecc_status() != ECC_STATUS_CE) {
+        errors++;
+    }
+    ecc_clear_status();
+    ecc_inject(0, 0x12345678, 0x3U << 7, 0);
+    (void)Xil_In32(BRAM_BASE_ADDR);
+    if ((ecc_status() & ECC_STATUS_UE) == 0) {
+        errors++;
+    }
+    Xil_Out32(BRAM_BASE_ADDR, 0);
+    ecc_clear_status();
+    return errors;
+}
+
+/**
+ * @brief 액세스 패턴 행렬 (모든 폭, 기본 반복/stride), 데이터 검사 오류 반환
+ */
+static u32 run_matrix(void)
+{
+    static const matrix_cfg_t cfg = {
+        MATRIX_ALL_WIDTHS, MATRIX_DEFAULT_REPEATS, MATRIX_DEFAULT_STRIDE
+    };
+
+    return matrix_run(&cfg, 0);
+}
+
+static const autorun_test_t autorun_tests[] = {
+    {AUTORUN_PATTERN,    "pattern",    run_pattern},
+    {AUTORUN_ADDRESS,    "address",    run_address},
+    {AUTORUN_DATABUS,    "databus",    run_databus},
+    {AUTORUN_BYTE_LANES, "byte_lanes", run_byte_lanes},
+    {AUTORUN_THROUGHPUT, "throughput", run_throughput},
+    {AUTORUN_ECC,        "ecc",        run_ecc},
+    {AUTORUN_MATRIX,     "matrix",     run_matrix},
+};
+
+#define AUTORUN_NUM_TESTS   (sizeof(autorun_tests) / sizeof(autorun_tests[0]))
+
+/*******************************************************************************
+ * 실행
+ ******************************************************************************/
+u32 bram_autorun(XTime boot_ticks)
+{
+    u32 t_us[AUTORUN_NUM_TESTS];
+    XTime t0, t_start, t_end;
+    u32 i, fail = 0;
+
+    t_start = bench_now();
+    for (i = 0; i < AUTORUN_NUM_TESTS; i++) {
+        t_us[i] = 0;
+        if ((BRAM_AUTORUN_TESTS & autorun_tests[i].bit) == 0) {
+            continue;
+        }
+        t0 = bench_now();
+        if (autorun_tests[i].run() != 0) {
+            fail |= autorun_tests[i].bit;
+        }
+        t_us[i] = bench_ticks_to_us(bench_now() - t0);
+    }
+    t_end = bench_now();
+
+    xil_printf(AUTORUN_RECORD_PREFIX "{\"build\":\"%s\",\"result\":\"%s\",\"tests\":\"0x%02X\",\"fail\":\"0x%02X\"",
+               BRAM_BUILD_HASH, fail == 0 ? "PASS" : "FAIL", BRAM_AUTORUN_TESTS, fail);
+    xil_printf(",\"boot_us\":%d,\"run_us\":%d,\"reset_to_result_us\":%d",
+               bench_ticks_to_us(boot_ticks), bench_ticks_to_us(t_end - t_start),
+               bench_ticks_to_us(t_end));
+    for (i = 0; i < AUTORUN_NUM_TESTS; i++) {
+        if (BRAM_AUTORUN_TESTS & autorun_tests[i].bit) {
+            xil_printf(",\"%s_us\":%d", autorun_tests[i].name, t_us[i]);
+        }
+    }
+    if (BRAM_AUTORUN_TESTS & AUTORUN_THROUGHPUT) {
+        xil_printf(",\"wr_mbps\":%d.%02d,\"rd_mbps\":%d.%02d",
+                   autorun_tp.write_mbps_x100 / 100, autorun_tp.write_mbps_x100 % 100,
+                   autorun_tp.read_mbps_x100 / 100, autorun_tp.read_mbps_x100 % 100);
+    }
+    xil_printf("}\r\n");
+
+    return fail;
+}
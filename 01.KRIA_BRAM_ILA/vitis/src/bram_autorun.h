@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Headless Autorun
+ *
+ * File: bram_autorun.h
+ * Description: 메뉴 없이 부팅 직후 지정한 테스트를 연속 실행하고
+ *              한 줄짜리 pass/fail + 시간 레코드("@SELFTEST {...}")를 출력
+ *              (BRAM_HEADLESS 빌드 프로파일)
+ ******************************************************************************/
+
+#ifndef BRAM_AUTORUN_H
+#define BRAM_AUTORUN_H
+
+#include "xil_types.h"
+#include "xtime_l.h"
+#include "bram_test.h"
+
+/* 테스트 비트 (결과 레코드의 "tests" / "fail" 마스크와 동일) */
+#define AUTORUN_PATTERN         (1U << 0)   /* 고정 패턴 채우기/검증 */
+#define AUTORUN_ADDRESS         (1U << 1)   /* 주소 = 데이터 (주소선 단락/중복) */
+#define AUTORUN_DATABUS         (1U << 2)   /* walking 1/0 (데이터선) */
+#define AUTORUN_BYTE_LANES      (1U << 3)   /* 8비트 쓰기 레인 격리 */
+#define AUTORUN_THROUGHPUT      (1U << 4)   /* 쓰기/읽기 MB/s (+ 하한 검사) */
+#define AUTORUN_ECC             (1U << 5)   /* 단일/이중 비트 주입 (ECC 빌드) */
+#define AUTORUN_MATRIX          (1U << 6)   /* 액세스 패턴 행렬 (@BENCH 레코드, 기본 제외) */
+
+/* 실행할 테스트 - Vitis Symbols에서 변경 가능 */
+#ifndef BRAM_AUTORUN_TESTS
+#define BRAM_AUTORUN_TESTS      (AUTORUN_PATTERN | AUTORUN_ADDRESS | AUTORUN_DATABUS | \
+                                 AUTORUN_BYTE_LANES | AUTORUN_THROUGHPUT | \
+                                 (BRAM_ECC_ENABLED ? AUTORUN_ECC : 0))
+#endif
+
+/* 처리량 하한 (MB/s, 0이면 측정만 하고 검사하지 않음) */
+#ifndef BRAM_AUTORUN_MIN_MBPS
+#define BRAM_AUTORUN_MIN_MBPS   0
+#endif
+
+#define AUTORUN_THROUGHPUT_ROUNDS   16
+#define AUTORUN_RECORD_PREFIX       "@SELFTEST "
+
+/**
+ * @brief 자가 테스트 실행
+ * @param boot_ticks main() 진입 시 글로벌 타이머 값 (시스템 카운터 시작 이후)
+ * @return 실패한 테스트 비트 마스크 (0 = PASS)
+ */
+u32 bram_autorun(XTime boot_ticks);
+
+#endif /* BRAM_AUTORUN_H */
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Multi-Bank Interleave
+ *
+ * File: bram_bank.c
+ * Description: 뱅크 인터리브 주소 변환, 대량 전송, 매핑 검증과
+ *              뱅크 수 / stripe 크기별 처리량 스케일링 (메뉴 18)
+ *
+ * CPU 한 코어에서 쓰기는 posted 트랜잭션이라 stripe가 바뀔 때마다 다음 뱅크로
+ * 바로 넘어가고, HPM0/HPM1_FPD와 각 포트의 인터커넥트가 동시에 진행합니다.
+ * 읽기는 응답을 기다리므로 뱅크 수보다 포트 경로 지연의 영향을 더 받습니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_result.h"
+#include "bram_bank.h"
+#include "bram_snap.h"
+
+#if BRAM_BANK_COUNT < 1 || BRAM_BANK_COUNT > BRAM_BANK_MAX
+#error "BRAM_BANK_COUNT must be 1..4 (create_project.tcl -banks)"
+#endif
+
+/* 기본 인터리브 단위 (워드) */
+#ifndef BRAM_BANK_STRIPE_WORDS
+#define BRAM_BANK_STRIPE_WORDS  16
+#endif
+
+#define BANK_NUM_STRIPES    3
+#define BANK_CHECK_WORDS    128
+#define BANK_PATTERN(i, seed)   (((i) * 0x9E3779B1U) ^ (seed))
+
+static u32 bank_count;
+static u32 stripe_shift;
+static UINTPTR bank_base[BRAM_BANK_MAX];
+
+static u32 bank_buf[BRAM_BANK_MAX * BRAM_SIZE_WORDS];
+static u32 bank_chk[BANK_CHECK_WORDS];
+
+/*******************************************************************************
+ * 주소 변환
+ ******************************************************************************/
+UINTPTR bram_bank_base(u32 bank)
+{
+#if BRAM_BANK_COUNT > 1
+    return (UINTPTR)((bank & 1) ? BRAM_BANK_HPM1_BASE : BRAM_BANK_HPM0_BASE) +
+           (bank >> 1) * BRAM_SIZE_BYTES;
+#else
+    (void)bank;
+    return BRAM_BASE_ADDR;
+#endif
+}
+
+u32 bram_bank_config(u32 banks, u32 stripe_words)
+{
+    u32 i, shift = 0;
+
+    if (banks < 1 || banks > BRAM_BANK_COUNT || stripe_words == 0 ||
+        stripe_words > BRAM_SIZE_WORDS || (stripe_words & (stripe_words - 1)) != 0) {
+        return 0;
+    }
+    while ((1U << shift) < stripe_words) {
+        shift++;
+    }
+
+    bank_count = banks;
+    stripe_shift = shift;
+    for (i = 0; i < banks; i++) {
+        bank_base[i] = bram_bank_base(i);
+    }
+    return banks * BRAM_SIZE_WORDS;
+}
+
+static void bank_init(void)
+{
+    if (bank_count == 0) {
+        bram_bank_config(BRAM_BANK_COUNT, BRAM_BANK_STRIPE_WORDS);
+    }
+}
+
+/* offset + count가 현재 인터리브 공간 안인지 (u32 wrap 없이 비교) */
+static int bank_range_ok(u32 offset, u32 count)
+{
+    u32 words = bank_count * BRAM_SIZE_WORDS;
+
+    return offset <= words && count <= words - offset;
+}
+
+UINTPTR bram_bank_addr(u32 offset)
+{
+    u32 chunk, row;
+
+    bank_init();
+    chunk = offset >> stripe_shift;
+    row = chunk / bank_count;
+    return bank_base[chunk % bank_count] +
+           (((row << stripe_shift) | (offset & ((1U << stripe_shift) - 1))) * 4);
+}
+
+/*******************************************************************************
+ * 대량 전송
+ ******************************************************************************/
+/**
+ * @brief 인터리브 공간에 쓰기
+ *
+ * 시작 위치만 나눗셈으로 구하고, 이후에는 stripe가 끝날 때마다
+ * 다음 뱅크로 넘어가며 한 바퀴 돌면 행 오프셋을 stripe만큼 올립니다.
+ * 범위를 넘는 요청은 다음 뱅크 창 밖으로 쓰기 전에 거부합니다.
+ */
+BRAM_HOT int bram_bank_write(u32 offset, const u32 *src, u32 count)
+{
+    u32 stripe, chunk, bank, in, len, i;
+    UINTPTR row, addr;
+
+    bank_init();
+    if (!bank_range_ok(offset, count)) {
+        return 0;
+    }
+    stripe = 1U << stripe_shift;
+    chunk = offset >> stripe_shift;
+    bank = chunk % bank_count;
+    row = (UINTPTR)(chunk / bank_count) << (stripe_shift + 2);
+    in = offset & (stripe - 1);
+
+    while (count > 0) {
+        addr = bank_base[bank] + row + (in * 4);
+        len = stripe - in;
+        if (len > count) {
+            len = count;
+        }
+        for (i = 0; i < len; i++) {
+            Xil_Out32(addr + (i * 4), src[i]);
+        }
+        src += len;
+        count -= len;
+        in = 0;
+        if (++bank == bank_count) {
+            bank = 0;
+            row += (UINTPTR)stripe * 4;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief 인터리브 공간에서 읽기 (순회 방식은 bram_bank_write와 동일)
+ */
+BRAM_HOT int bram_bank_read(u32 offset, u32 *dst, u32 count)
+{
+    u32 stripe, chunk, bank, in, len, i;
+    UINTPTR row, addr;
+
+    bank_init();
+    if (!bank_range_ok(offset, count)) {
+        return 0;
+    }
+    stripe = 1U << stripe_shift;
+    chunk = offset >> stripe_shift;
+    bank = chunk % bank_count;
+    row = (UINTPTR)(chunk / bank_count) << (stripe_shift + 2);
+    in = offset & (stripe - 1);
+
+    while (count > 0) {
+        addr = bank_base[bank] + row + (in * 4);
+        len = stripe - in;
+        if (len > count) {
+            len = count;
+        }
+        for (i = 0; i < len; i++) {
+            dst[i] = Xil_In32(addr + (i * 4));
+        }
+        dst += len;
+        count -= len;
+        in = 0;
+        if (++bank == bank_count) {
+            bank = 0;
+            row += (UINTPTR)stripe * 4;
+        }
+    }
+    return 1;
+}
+
+/*******************************************************************************
+ * 검증
+ ******************************************************************************/
+/**
+ * @brief 전체 공간을 인터리브로 쓰고, 각 뱅크의 물리 워드가
+ *        기대한 논리 오프셋의 값인지 / 단일 변환 / 대량 읽기가 일치하는지 확인
+ */
+static u32 check_mapping(u32 banks, u32 stripe)
+{
+    u32 words = bram_bank_config(banks, stripe);
+    u32 seed = 0xB0000000U + stripe;
+    u32 i, b, w, logical, errors = 0;
+
+    for (i = 0; i < words; i++) {
+        bank_buf[i] = BANK_PATTERN(i, seed);
+    }
+    bram_bank_write(0, bank_buf, words);
+
+    for (b = 0; b < banks; b++) {
+        for (w = 0; w < BRAM_SIZE_WORDS; w++) {
+            logical = ((w / stripe) * banks + b) * stripe + (w % stripe);
+            if (Xil_In32(bram_bank_base(b) + (w * 4)) != BANK_PATTERN(logical, seed)) {
+                errors++;
+            }
+        }
+    }
+    for (i = 0; i < words; i++) {
+        if (Xil_In32(bram_bank_addr(i)) != BANK_PATTERN(i, seed)) {
+            errors++;
+        }
+    }
+
+    for (i = 0; i < words; i++) {
+        bank_buf[i] = 0;
+    }
+    bram_bank_read(0, bank_buf, words);
+    for (i = 0; i < words; i++) {
+        if (bank_buf[i] != BANK_PATTERN(i, seed)) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief stripe/뱅크 경계를 걸치는 부분 전송이 주변 워드를 건드리지 않는지,
+ *        공간을 넘는 전송이 거부되는지
+ */
+static u32 check_partial(u32 banks)
+{
+    static const u32 cases[][2] = {
+        {0, 1}, {15, 2}, {17, 40}, {31, 97}, {63, 66},
+    };
+    u32 words = bram_bank_config(banks, BRAM_BANK_STRIPE_WORDS);
+    u32 c, i, start, len, off, expect, errors = 0;
+
+    for (c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        /* 홀수 케이스는 공간 중간(다른 행)에서 시작 */
+        start = cases[c][0] + ((c & 1) ? words / 2 : 0);
+        len = cases[c][1];
+
+        for (i = 0; i < words; i++) {
+            bank_buf[i] = BANK_PATTERN(i, 0);
+        }
+        bram_bank_write(0, bank_buf, words);
+
+        for (i = 0; i < len; i++) {
+            bank_chk[i] = ~BANK_PATTERN(start + i, 0);
+        }
+        bram_bank_write(start, bank_chk, len);
+
+        /* 앞뒤 한 워드씩 포함해서 다시 읽기 */
+        off = (start > 0) ? start - 1 : 0;
+        bram_bank_read(off, bank_chk, start + len + 1 - off);
+        for (i = 0; i < start + len + 1 - off; i++) {
+            expect = BANK_PATTERN(off + i, 0);
+            if (off + i >= start && off + i < start + len) {
+                expect = ~expect;
+            }
+            if (bank_chk[i] != expect) {
+                errors++;
+            }
+        }
+    }
+
+    /* 공간 끝을 넘거나 u32로 wrap되는 요청은 거부되고 마지막 워드는 그대로 */
+    bank_chk[0] = 0;
+    bank_chk[1] = 0;
+    if (bram_bank_write(words - 1, bank_chk, 2) || bram_bank_write(1, bank_chk, 0xFFFFFFFFU) ||
+        bram_bank_read(words, bank_chk, 1)) {
+        errors++;
+    }
+    if (Xil_In32(bram_bank_addr(words - 1)) != BANK_PATTERN(words - 1, 0)) {
+        errors++;
+    }
+    return errors;
+}
+
+/*******************************************************************************
+ * 스케일링
+ ******************************************************************************/
+static void bench_banks(bench_throughput_t *r, u32 banks, u32 stripe)
+{
+    u32 words = bram_bank_config(banks, stripe);
+    u32 i;
+    XTime t0, tw, tr;
+
+    for (i = 0; i < words; i++) {
+        bank_buf[i] = i;
+    }
+
+    t0 = bench_now();
+    for (i = 0; i < BANK_BENCH_ROUNDS; i++) {
+        bram_bank_write(0, bank_buf, words);
+    }
+    tw = bench_now() - t0;
+
+    t0 = bench_now();
+    for (i = 0; i < BANK_BENCH_ROUNDS; i++) {
+        bram_bank_read(0, bank_buf, words);
+    }
+    tr = bench_now() - t0;
+
+    r->write_mbps_x100 = bench_mbps_x100(words * 4 * BANK_BENCH_ROUNDS, tw);
+    r->read_mbps_x100 = bench_mbps_x100(words * 4 * BANK_BENCH_ROUNDS, tr);
+}
+
+static u32 ratio_x100(u32 value_x100, u32 base_x100)
+{
+    return base_x100 == 0 ? 0 : (u32)(((u64)value_x100 * 100) / base_x100);
+}
+
+/*******************************************************************************
+ * 메뉴 18
+ ******************************************************************************/
+/**
+ * @brief 매핑/부분 전송 검증 + 뱅크 수별 처리량 스케일링 보고
+ */
+void test_bank_interleave(void)
+{
+    static const u32 stripes[BANK_NUM_STRIPES] = {1, 16, 256};
+    static const char *record_names[BRAM_BANK_MAX][BANK_NUM_STRIPES] = {
+        {"1 bank stripe 4B",  "1 bank stripe 64B",  "1 bank stripe 1KB"},
+        {"2 banks stripe 4B", "2 banks stripe 64B", "2 banks stripe 1KB"},
+        {"3 banks stripe 4B", "3 banks stripe 64B", "3 banks stripe 1KB"},
+        {"4 banks stripe 4B", "4 banks stripe 64B", "4 banks stripe 1KB"},
+    };
+    static const char *mapping_names[BRAM_BANK_MAX] = {
+        "1 bank  (stripe 4B / 64B / 1KB)",
+        "2 banks (stripe 4B / 64B / 1KB)",
+        "3 banks (stripe 4B / 64B / 1KB)",
+        "4 banks (stripe 4B / 64B / 1KB)",
+    };
+    bench_throughput_t base[BANK_NUM_STRIPES];
+    bench_throughput_t r;
+    u32 n, s, errors, fails = 0;
+
+    xil_printf("=== Multi-Bank Interleave ===\r\n");
+#if BRAM_BANK_COUNT > 1
+    xil_printf("Banks: %d x %d KB, default stripe %d words\r\n",
+               BRAM_BANK_COUNT, BRAM_SIZE_BYTES / 1024, BRAM_BANK_STRIPE_WORDS);
+#else
+    xil_printf("Single-bank build: BRAM @ 0x%08X is bank 0\r\n", BRAM_BASE_ADDR);
+    xil_printf("(build with create_project.tcl -banks 2..4 and BRAM_BANK_COUNT to scale)\r\n");
+#endif
+    for (n = 0; n < BRAM_BANK_COUNT; n++) {
+        xil_printf("  bank %d  0x%08X  %s\r\n", n, (u32)bram_bank_base(n),
+                   BRAM_BANK_COUNT == 1 ? "HPM0_LPD" : ((n & 1) ? "HPM1_FPD" : "HPM0_FPD"));
+    }
+
+    xil_printf("\r\n[1] Address mapping\r\n");
+    for (n = 1; n <= BRAM_BANK_COUNT; n++) {
+        errors = 0;
+        for (s = 0; s < BANK_NUM_STRIPES; s++) {
+            errors += check_mapping(n, stripes[s]);
+        }
+        fails += bench_report(mapping_names[n - 1], errors);
+    }
+
+    xil_printf("\r\n[2] Partial transfers across stripe/bank boundaries\r\n");
+    fails += bench_report("neighbours untouched, overrun rejected", check_partial(BRAM_BANK_COUNT));
+
+    xil_printf("\r\n[3] Throughput vs bank count (%d rounds x banks x %d KB)\r\n",
+               BANK_BENCH_ROUNDS, BRAM_SIZE_BYTES / 1024);
+    xil_printf("  Banks  Stripe   Write MB/s  Read MB/s  Write x  Read x\r\n");
+    bench_result_begin("bank");
+    for (n = 1; n <= BRAM_BANK_COUNT; n++) {
+        for (s = 0; s < BANK_NUM_STRIPES; s++) {
+            bench_banks(&r, n, stripes[s]);
+            if (n == 1) {
+                base[s] = r;
+            }
+            xil_printf("  %d      %4d B   ", n, stripes[s] * 4);
+            bench_print_x100(r.write_mbps_x100, 10);
+            xil_printf("  ");
+            bench_print_x100(r.read_mbps_x100, 9);
+            xil_printf("  ");
+            bench_print_x100(ratio_x100(r.write_mbps_x100, base[s].write_mbps_x100), 7);
+            xil_printf("  ");
+            bench_print_x100(ratio_x100(r.read_mbps_x100, base[s].read_mbps_x100), 6);
+            xil_printf("\r\n");
+            bench_result_add(record_names[n - 1][s], 32, 0,
+                             r.write_mbps_x100, r.read_mbps_x100, NULL);
+        }
+    }
+    xil_printf("  (x = speedup over 1 bank with the same stripe)\r\n");
+
+    bram_bank_config(BRAM_BANK_COUNT, BRAM_BANK_STRIPE_WORDS);
+    xil_printf("\r\nResult: %s (%d failures)\r\n", fails == 0 ? "PASS" : "FAIL", fails);
+#if BRAM_BANK_COUNT == 1
+    /* 단일 뱅크 빌드의 뱅크 0은 스냅샷 대상 BRAM 그 자체 */
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+#endif
+    bench_result_flush();
+}
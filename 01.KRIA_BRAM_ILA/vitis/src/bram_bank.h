@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Multi-Bank Interleave
+ *
+ * File: bram_bank.h
+ * Description: HPM0_FPD / HPM1_FPD 뒤의 BRAM 뱅크(create_project.tcl -banks)를
+ *              하나의 연속 워드 공간으로 묶는 주소 인터리브 계층과
+ *              뱅크 수별 처리량 스케일링 측정
+ *
+ * 논리 워드 오프셋 → (stripe 단위로) 뱅크 0, 1, ... N-1, 0, 1, ... 순서로 분산.
+ * 뱅크 i는 HPM(i % 2)_FPD에 있으므로 인접 stripe는 서로 다른 포트로 나갑니다.
+ * BRAM_BANK_COUNT == 1 빌드에서는 기존 BRAM(0x80000000) 하나를 뱅크 0으로 사용합니다.
+ ******************************************************************************/
+
+#ifndef BRAM_BANK_H
+#define BRAM_BANK_H
+
+#include "xil_types.h"
+#include "bram_test.h"
+
+#define BRAM_BANK_MAX       4
+#define BANK_BENCH_ROUNDS   8
+
+/**
+ * @brief 사용할 뱅크 수와 인터리브 단위 설정
+ * @param banks 1 ~ BRAM_BANK_COUNT
+ * @param stripe_words 2의 거듭제곱, 1 ~ BRAM_SIZE_WORDS
+ * @return 인터리브 공간 크기 (워드), 설정 불가 시 0
+ */
+u32 bram_bank_config(u32 banks, u32 stripe_words);
+
+/* 뱅크 물리 베이스 주소 */
+UINTPTR bram_bank_base(u32 bank);
+
+/* 논리 워드 오프셋 → 물리 주소 */
+UINTPTR bram_bank_addr(u32 offset);
+
+/**
+ * @brief 인터리브 공간 대량 전송 (stripe 경계에서만 주소 재계산)
+ * @return 1 = 전송, 0 = offset + count가 인터리브 공간(뱅크 수 x BRAM_SIZE_WORDS)을
+ *         넘음 (아무것도 전송하지 않음)
+ */
+int bram_bank_write(u32 offset, const u32 *src, u32 count);
+int bram_bank_read(u32 offset, u32 *dst, u32 count);
+
+/* 메뉴 18 */
+void test_bank_interleave(void);
+
+#endif /* BRAM_BANK_H */
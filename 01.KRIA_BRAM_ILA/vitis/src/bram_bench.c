@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 벤치마크 공용 함수
+ *
+ * File: bram_bench.c
+ * Description: XTime 기반 시간 측정과 BRAM 전체 읽기/쓰기 처리량 측정
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+
+/**
+ * @brief 현재 글로벌 타이머 값
+ */
+XTime bench_now(void)
+{
+    XTime t;
+    XTime_GetTime(&t);
+    return t;
+}
+
+/**
+ * @brief 타이머 틱 → 마이크로초
+ */
+u32 bench_ticks_to_us(XTime ticks)
+{
+    return (u32)(((u64)ticks * 1000000ULL) / COUNTS_PER_SECOND);
+}
+
+/**
+ * @brief 바이트 수와 경과 틱으로 MB/s x 100 계산
+ */
+u32 bench_mbps_x100(u32 bytes, XTime ticks)
+{
+    if (ticks == 0) {
+        return 0;
+    }
+    /* bytes / (ticks / CPS) / 1e6 * 100 */
+    return (u32)(((u64)bytes * COUNTS_PER_SECOND) / ((u64)ticks * 10000ULL));
+}
+
+/**
+ * @brief 경과 틱을 워드당 CPU 사이클 x 100으로 환산
+ */
+u32 bench_cycles_per_word_x100(XTime ticks, u32 words)
+{
+    if (words == 0) {
+        return 0;
+    }
+    /* ticks * (CPU_HZ / CPS) / words * 100 */
+    return (u32)(((u64)ticks * (BENCH_CPU_HZ / 10000U) * 100U) /
+                 ((u64)(COUNTS_PER_SECOND / 10000U) * words));
+}
+
+/**
+ * @brief x100 고정소수점 값 출력 (예: 12345 → "123.45")
+ * @param width 최소 폭, 오른쪽 정렬 (0 = 패딩 없음)
+ *
+ * xil_printf는 "%*d"를 지원하지 않으므로 앞 공백을 직접 붙입니다.
+ */
+void bench_print_x100(u32 value_x100, u32 width)
+{
+    static const char spaces[] = "                ";
+    u32 len = 4;    /* "d.dd" */
+    u32 pad, v;
+
+    for (v = value_x100 / 100; v >= 10; v /= 10) {
+        len++;
+    }
+    pad = width > len ? width - len : 0;
+    if (pad > sizeof(spaces) - 1) {
+        pad = sizeof(spaces) - 1;
+    }
+    xil_printf("%s%d.%02d", &spaces[sizeof(spaces) - 1 - pad],
+               value_x100 / 100, value_x100 % 100);
+}
+
+/**
+ * @brief 검사 항목 한 줄 출력 ("  <name>  PASS" / "FAIL (n errors)")
+ * @param errors 오류 수 (0 = PASS)
+ * @return 실패 항목 수 (0 또는 1), 호출 측에서 합산
+ */
+u32 bench_report(const char *name, u32 errors)
+{
+    xil_printf("  %-40s %s", name, errors == 0 ? "PASS" : "FAIL");
+    if (errors != 0) {
+        xil_printf(" (%d errors)", errors);
+    }
+    xil_printf("\r\n");
+    return errors == 0 ? 0 : 1;
+}
+
+/**
+ * @brief 전체 BRAM 쓰기/읽기 처리량 측정
+ * @param result 측정 결과
+ * @param rounds 전체 BRAM을 반복할 횟수
+ */
+BRAM_HOT void bench_bram_throughput(bench_throughput_t *result, u32 rounds)
+{
+    u32 r, i;
+    u32 sum = 0;
+    XTime t0, t1;
+    u32 bytes = rounds * BRAM_SIZE_BYTES;
+
+    t0 = bench_now();
+    for (r = 0; r < rounds; r++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            Xil_Out32(BRAM_BASE_ADDR + (i * 4), i ^ r);
+        }
+    }
+    t1 = bench_now();
+    result->write_mbps_x100 = bench_mbps_x100(bytes, t1 - t0);
+
+    t0 = bench_now();
+    for (r = 0; r < rounds; r++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            sum += Xil_In32(BRAM_BASE_ADDR + (i * 4));
+        }
+    }
+    t1 = bench_now();
+    result->read_mbps_x100 = bench_mbps_x100(bytes, t1 - t0);
+
+    (void)sum;
+}
+
+/**
+ * @brief 시드 기반 패턴을 쓰고 다시 읽어 불일치 워드 수 반환
+ */
+BRAM_HOT u32 bench_bram_verify(u32 seed)
+{
+    u32 i;
+    u32 errors = 0;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        Xil_Out32(BRAM_BASE_ADDR + (i * 4), (i * 0x9E3779B9U) ^ seed);
+    }
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        if (Xil_In32(BRAM_BASE_ADDR + (i * 4)) != ((i * 0x9E3779B9U) ^ seed)) {
+            errors++;
+        }
+    }
+    return errors;
+}
@@ -0,0 +1,38 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 벤치마크 공용 함수
+ *
+ * File: bram_bench.h
+ * Description: XTime 기반 시간 측정과 BRAM 전체 읽기/쓰기 처리량 측정
+ ******************************************************************************/
+
+#ifndef BRAM_BENCH_H
+#define BRAM_BENCH_H
+
+#include "xil_types.h"
+#include "xparameters.h"
+#include "xtime_l.h"
+
+/* APU 클럭 (사이클 환산용) */
+#ifdef XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ
+#define BENCH_CPU_HZ        XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ
+#else
+#define BENCH_CPU_HZ        1333333008U
+#endif
+
+/* 처리량 측정 결과 (MB/s x 100, xil_printf는 %f를 지원하지 않음) */
+typedef struct {
+    u32 write_mbps_x100;
+    u32 read_mbps_x100;
+} bench_throughput_t;
+
+XTime bench_now(void);
+u32 bench_ticks_to_us(XTime ticks);
+u32 bench_mbps_x100(u32 bytes, XTime ticks);
+u32 bench_cycles_per_word_x100(XTime ticks, u32 words);
+void bench_print_x100(u32 value_x100, u32 width);
+u32 bench_report(const char *name, u32 errors);
+
+void bench_bram_throughput(bench_throughput_t *result, u32 rounds);
+u32 bench_bram_verify(u32 seed);
+
+#endif /* BRAM_BENCH_H */
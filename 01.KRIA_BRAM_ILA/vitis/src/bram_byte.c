@@ -0,0 +1,475 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Byte / Halfword Access
+ *
+ * File: bram_byte.c
+ * Description: 8/16비트 협소 AXI 쓰기(WSTRB)와 32비트 읽기-수정-쓰기(RMW)
+ *              구현, 바이트 레인 격리 검증 및 두 방식의 비용 비교
+ *
+ * BRAM은 Use_Byte_Write_Enable = true 이므로 AXI BRAM Controller가 WSTRB를
+ * 바이트 쓰기 인에이블로 전달합니다. 협소 쓰기는 AXI 쓰기 1회, RMW는
+ * 읽기 1회(왕복 대기) + 쓰기 1회가 필요합니다.
+ * ECC 빌드에서는 컨트롤러가 협소 쓰기를 내부 RMW로 처리하므로 비용이 달라집니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_byte.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+
+#define BYTE_BENCH_ROUNDS       8
+#define BYTE_COPY_WINDOW        64      /* 복사 검증 창 시작 워드 */
+#define BYTE_COPY_WINDOW_WORDS  12
+#define BYTE_COPY_MAX_LEN       32
+#define BYTE_GUARD              0xEE
+
+static u8 src_buf[BRAM_SIZE_BYTES];
+static u8 chk_buf[BRAM_SIZE_BYTES];
+
+/*******************************************************************************
+ * 단일 액세스
+ ******************************************************************************/
+void bram_write8(u32 byte_offset, u8 value)
+{
+    Xil_Out8(BRAM_BASE_ADDR + byte_offset, value);
+}
+
+void bram_write16(u32 byte_offset, u16 value)
+{
+    Xil_Out16(BRAM_BASE_ADDR + byte_offset, value);
+}
+
+u8 bram_read8(u32 byte_offset)
+{
+    return Xil_In8(BRAM_BASE_ADDR + byte_offset);
+}
+
+u16 bram_read16(u32 byte_offset)
+{
+    return Xil_In16(BRAM_BASE_ADDR + byte_offset);
+}
+
+/**
+ * @brief 워드를 읽어 mask 레인만 교체한 뒤 다시 쓰기
+ */
+static void rmw_word(u32 byte_offset, u32 value, u32 mask)
+{
+    u32 addr = BRAM_BASE_ADDR + (byte_offset & ~3U);
+    u32 shift = (byte_offset & 3U) * 8;
+    u32 word = Xil_In32(addr);
+
+    word = (word & ~(mask << shift)) | ((value & mask) << shift);
+    Xil_Out32(addr, word);
+}
+
+void bram_write8_rmw(u32 byte_offset, u8 value)
+{
+    rmw_word(byte_offset, value, 0xFFU);
+}
+
+void bram_write16_rmw(u32 byte_offset, u16 value)
+{
+    rmw_word(byte_offset, value, 0xFFFFU);
+}
+
+/*******************************************************************************
+ * 바이트 범위 복사
+ ******************************************************************************/
+static u32 load_le32(const u8 *p)
+{
+    return (u32)p[0] | ((u32)p[1] << 8) | ((u32)p[2] << 16) | ((u32)p[3] << 24);
+}
+
+/**
+ * @brief 부분 워드(같은 워드 안의 n바이트)에 필요한 협소 쓰기 수
+ *        (2바이트 정렬이면 16비트, 아니면 8비트)
+ */
+static u32 narrow_writes_needed(u32 byte_offset, u32 n)
+{
+    u32 count = 0;
+
+    while (n > 0) {
+        if ((byte_offset & 1U) == 0 && n >= 2) {
+            byte_offset += 2;
+            n -= 2;
+        } else {
+            byte_offset++;
+            n--;
+        }
+        count++;
+    }
+    return count;
+}
+
+static void write_partial_narrow(u32 byte_offset, const u8 *src, u32 n)
+{
+    while (n > 0) {
+        if ((byte_offset & 1U) == 0 && n >= 2) {
+            bram_write16(byte_offset, (u16)(src[0] | (src[1] << 8)));
+            byte_offset += 2;
+            src += 2;
+            n -= 2;
+        } else {
+            bram_write8(byte_offset, src[0]);
+            byte_offset++;
+            src++;
+            n--;
+        }
+    }
+}
+
+static void write_partial_rmw(u32 byte_offset, const u8 *src, u32 n)
+{
+    u32 value = 0, mask = 0, i;
+
+    for (i = 0; i < n; i++) {
+        value |= (u32)src[i] << (i * 8);
+        mask |= 0xFFU << (i * 8);
+    }
+    rmw_word(byte_offset, value, mask);
+}
+
+/**
+ * @brief 정렬 안 된 머리/꼬리는 부분 워드, 가운데는 32비트 워드로 복사
+ * @param narrow_max 부분 워드당 허용할 협소 쓰기 수 (0이면 항상 RMW)
+ */
+static void copy_to_bram(u32 dst_byte, const u8 *src, u32 len, u32 narrow_max)
+{
+    u32 n;
+
+    if ((dst_byte & 3U) != 0 && len > 0) {
+        n = 4 - (dst_byte & 3U);
+        if (n > len) {
+            n = len;
+        }
+        if (narrow_writes_needed(dst_byte, n) <= narrow_max) {
+            write_partial_narrow(dst_byte, src, n);
+        } else {
+            write_partial_rmw(dst_byte, src, n);
+        }
+        dst_byte += n;
+        src += n;
+        len -= n;
+    }
+
+    while (len >= 4) {
+        Xil_Out32(BRAM_BASE_ADDR + dst_byte, load_le32(src));
+        dst_byte += 4;
+        src += 4;
+        len -= 4;
+    }
+
+    if (len > 0) {
+        if (narrow_writes_needed(dst_byte, len) <= narrow_max) {
+            write_partial_narrow(dst_byte, src, len);
+        } else {
+            write_partial_rmw(dst_byte, src, len);
+        }
+    }
+}
+
+/**
+ * @brief DDR → BRAM 바이트 범위 복사 (부분 워드는 BRAM_BYTE_NARROW_MAX 이하면 협소 쓰기)
+ */
+void bram_copy_to_bram(u32 dst_byte, const u8 *src, u32 len)
+{
+    copy_to_bram(dst_byte, src, len, BRAM_BYTE_NARROW_MAX);
+}
+
+/**
+ * @brief DDR → BRAM 바이트 범위 복사 (부분 워드는 항상 RMW, 비교용)
+ */
+void bram_copy_to_bram_rmw(u32 dst_byte, const u8 *src, u32 len)
+{
+    copy_to_bram(dst_byte, src, len, 0);
+}
+
+/**
+ * @brief BRAM → DDR 바이트 범위 복사
+ *
+ * 읽기는 폭과 관계없이 AXI 읽기 1회이므로 워드 단위로 읽고 바이트를 추출합니다.
+ */
+void bram_copy_from_bram(u8 *dst, u32 src_byte, u32 len)
+{
+    u32 word, lane;
+
+    while (len > 0) {
+        word = Xil_In32(BRAM_BASE_ADDR + (src_byte & ~3U));
+        for (lane = src_byte & 3U; lane < 4 && len > 0; lane++) {
+            *dst++ = (u8)(word >> (lane * 8));
+            src_byte++;
+            len--;
+        }
+    }
+}
+
+/*******************************************************************************
+ * 검증
+ ******************************************************************************/
+/**
+ * @brief 레인 하나에 협소 쓰기 → 같은 워드의 다른 레인과 이웃 워드가 유지되는지 확인
+ * @param size 1 또는 2 (바이트)
+ */
+static u32 check_lane_isolation(u32 size)
+{
+    static const u32 backgrounds[] = {0x00000000, 0xFFFFFFFF, 0x5A5AA5A5};
+    static const u32 words[] = {0, 1, BRAM_SIZE_WORDS / 2, BRAM_MAX_OFFSET};
+    u32 mask = (size == 1) ? 0xFFU : 0xFFFFU;
+    u32 b, w, lane, off, bg, value, expect, errors = 0;
+
+    for (b = 0; b < sizeof(backgrounds) / sizeof(backgrounds[0]); b++) {
+        bg = backgrounds[b];
+        for (w = 0; w < sizeof(words) / sizeof(words[0]); w++) {
+            off = words[w];
+            for (lane = 0; lane < 4; lane += size) {
+                if (off > 0) {
+                    Xil_Out32(BRAM_BASE_ADDR + (off - 1) * 4, ~bg);
+                }
+                if (off < BRAM_MAX_OFFSET) {
+                    Xil_Out32(BRAM_BASE_ADDR + (off + 1) * 4, ~bg);
+                }
+                Xil_Out32(BRAM_BASE_ADDR + off * 4, bg);
+
+                value = (0xC33C96A5U >> (lane * 8)) & mask;
+                if (size == 1) {
+                    bram_write8(off * 4 + lane, (u8)value);
+                } else {
+                    bram_write16(off * 4 + lane, (u16)value);
+                }
+                expect = (bg & ~(mask << (lane * 8))) | (value << (lane * 8));
+
+                if (Xil_In32(BRAM_BASE_ADDR + off * 4) != expect) {
+                    errors++;
+                }
+                if (size == 1 && bram_read8(off * 4 + lane) != value) {
+                    errors++;
+                }
+                if (size == 2 && bram_read16(off * 4 + lane) != value) {
+                    errors++;
+                }
+                if (off > 0 && Xil_In32(BRAM_BASE_ADDR + (off - 1) * 4) != ~bg) {
+                    errors++;
+                }
+                if (off < BRAM_MAX_OFFSET && Xil_In32(BRAM_BASE_ADDR + (off + 1) * 4) != ~bg) {
+                    errors++;
+                }
+            }
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief 정렬 0~3, 길이 0~BYTE_COPY_MAX_LEN 모든 조합을 가드 바이트 사이에 복사해 비교
+ */
+static u32 check_copy(int use_rmw)
+{
+    const u32 window = BYTE_COPY_WINDOW * 4;
+    const u32 window_bytes = BYTE_COPY_WINDOW_WORDS * 4;
+    u8 ref[BYTE_COPY_WINDOW_WORDS * 4];
+    u32 align, len, i, errors = 0;
+
+    for (align = 0; align < 4; align++) {
+        for (len = 0; len <= BYTE_COPY_MAX_LEN; len++) {
+            for (i = 0; i < BYTE_COPY_WINDOW_WORDS; i++) {
+                Xil_Out32(BRAM_BASE_ADDR + window + i * 4, 0xEEEEEEEEU);
+            }
+            for (i = 0; i < window_bytes; i++) {
+                ref[i] = BYTE_GUARD;
+            }
+            for (i = 0; i < len; i++) {
+                src_buf[i] = (u8)(i * 29 + len * 7 + align);
+                ref[4 + align + i] = src_buf[i];
+            }
+
+            if (use_rmw) {
+                bram_copy_to_bram_rmw(window + 4 + align, src_buf, len);
+            } else {
+                bram_copy_to_bram(window + 4 + align, src_buf, len);
+            }
+
+            bram_copy_from_bram(chk_buf, window, window_bytes);
+            for (i = 0; i < window_bytes; i++) {
+                if (chk_buf[i] != ref[i]) {
+                    errors++;
+                }
+            }
+        }
+    }
+    return errors;
+}
+
+/*******************************************************************************
+ * 벤치마크
+ ******************************************************************************/
+typedef struct {
+    XTime narrow;
+    XTime rmw;
+    u32 ops;            /* 측정 횟수 (저장 또는 레코드) */
+    u32 bytes;          /* 레코드 복사 시 전송 바이트 */
+    u32 errors;
+} byte_bench_t;
+
+static void bench_store(byte_bench_t *r, u32 size)
+{
+    u32 round, off;
+    XTime t0;
+
+    r->ops = BYTE_BENCH_ROUNDS * (BRAM_SIZE_BYTES / size);
+    r->bytes = BYTE_BENCH_ROUNDS * BRAM_SIZE_BYTES;
+
+    t0 = bench_now();
+    for (round = 0; round < BYTE_BENCH_ROUNDS; round++) {
+        for (off = 0; off < BRAM_SIZE_BYTES; off += size) {
+            if (size == 1) {
+                bram_write8(off, (u8)(off ^ round));
+            } else {
+                bram_write16(off, (u16)(off ^ round));
+            }
+        }
+    }
+    r->narrow = bench_now() - t0;
+
+    t0 = bench_now();
+    for (round = 0; round < BYTE_BENCH_ROUNDS; round++) {
+        for (off = 0; off < BRAM_SIZE_BYTES; off += size) {
+            if (size == 1) {
+                bram_write8_rmw(off, (u8)(off ^ round));
+            } else {
+                bram_write16_rmw(off, (u16)(off ^ round));
+            }
+        }
+    }
+    r->rmw = bench_now() - t0;
+
+    /* 마지막 라운드 값 확인 */
+    r->errors = 0;
+    for (off = 0; off < BRAM_SIZE_BYTES; off += size) {
+        if (size == 1 && bram_read8(off) != (u8)(off ^ (BYTE_BENCH_ROUNDS - 1))) {
+            r->errors++;
+        }
+        if (size == 2 && bram_read16(off) != (u16)(off ^ (BYTE_BENCH_ROUNDS - 1))) {
+            r->errors++;
+        }
+    }
+}
+
+/**
+ * @brief 크기 rec 바이트의 레코드를 빈틈없이 패킹해 BRAM 전체에 복사
+ */
+static void bench_records(byte_bench_t *r, u32 rec)
+{
+    u32 count = BRAM_SIZE_BYTES / rec;
+    u32 round, i;
+    XTime t0;
+
+    for (i = 0; i < BRAM_SIZE_BYTES; i++) {
+        src_buf[i] = (u8)(i * 13 + rec);
+    }
+    r->ops = BYTE_BENCH_ROUNDS * count;
+    r->bytes = BYTE_BENCH_ROUNDS * count * rec;
+
+    t0 = bench_now();
+    for (round = 0; round < BYTE_BENCH_ROUNDS; round++) {
+        for (i = 0; i < count; i++) {
+            bram_copy_to_bram(i * rec, &src_buf[i * rec], rec);
+        }
+    }
+    r->narrow = bench_now() - t0;
+
+    t0 = bench_now();
+    for (round = 0; round < BYTE_BENCH_ROUNDS; round++) {
+        for (i = 0; i < count; i++) {
+            bram_copy_to_bram_rmw(i * rec, &src_buf[i * rec], rec);
+        }
+    }
+    r->rmw = bench_now() - t0;
+
+    bram_copy_from_bram(chk_buf, 0, count * rec);
+    r->errors = 0;
+    for (i = 0; i < count * rec; i++) {
+        if (chk_buf[i] != src_buf[i]) {
+            r->errors++;
+        }
+    }
+}
+
+/**
+ * @brief 행 출력 + 협소/RMW 결과 레코드 2개 추가 (쓰기 MB/s만 측정)
+ */
+static void print_bench_values(const byte_bench_t *r, const char *narrow_name,
+                               const char *rmw_name, u32 width)
+{
+    bench_print_x100(bench_cycles_per_word_x100(r->narrow, r->ops), 10);
+    xil_printf("  ");
+    bench_print_x100(bench_cycles_per_word_x100(r->rmw, r->ops), 7);
+    xil_printf("  ");
+    bench_print_x100(bench_mbps_x100(r->bytes, r->narrow), 11);
+    xil_printf("  ");
+    bench_print_x100(bench_mbps_x100(r->bytes, r->rmw), 8);
+    xil_printf("  %s\r\n", r->errors == 0 ? "OK" : "ERR");
+
+    bench_result_add(narrow_name, width, 0, bench_mbps_x100(r->bytes, r->narrow), BENCH_NONE, NULL);
+    bench_result_add(rmw_name, width, 0, bench_mbps_x100(r->bytes, r->rmw), BENCH_NONE, NULL);
+}
+
+/*******************************************************************************
+ * 메뉴 16
+ ******************************************************************************/
+/**
+ * @brief 바이트/하프워드 액세스 검증 + 협소 쓰기 vs RMW 벤치마크
+ */
+void test_byte_access(void)
+{
+    static const u32 records[] = {3, 6, 13};
+    static const char *record_names[][2] = {
+        {"3-byte record narrow", "3-byte record rmw"},
+        {"6-byte record narrow", "6-byte record rmw"},
+        {"13-byte record narrow", "13-byte record rmw"},
+    };
+    byte_bench_t r;
+    u32 i, fails = 0;
+
+    xil_printf("=== Byte / Halfword Access Test ===\r\n");
+    xil_printf("Partial words: up to %d narrow writes, otherwise RMW\r\n",
+               BRAM_BYTE_NARROW_MAX);
+#if BRAM_ECC_ENABLED
+    xil_printf("ECC build: controller turns narrow writes into internal RMW\r\n");
+#endif
+
+    xil_printf("\r\n[1] Byte lane isolation\r\n");
+    fails += bench_report("8-bit writes touch only their lane", check_lane_isolation(1));
+    fails += bench_report("16-bit writes touch only their lanes", check_lane_isolation(2));
+
+    xil_printf("\r\n[2] Byte range copy (align 0-3, len 0-%d)\r\n", BYTE_COPY_MAX_LEN);
+    fails += bench_report("narrow head/tail copy", check_copy(0));
+    fails += bench_report("RMW head/tail copy", check_copy(1));
+
+    xil_printf("\r\n[3] Narrow write vs read-modify-write (%d rounds x 8KB)\r\n",
+               BYTE_BENCH_ROUNDS);
+    bench_result_begin("byte");
+    xil_printf("  Operation       Narrow cyc  RMW cyc  Narrow MB/s  RMW MB/s  Check\r\n");
+
+    bench_store(&r, 1);
+    xil_printf("  8-bit store     ");
+    print_bench_values(&r, "8-bit store narrow", "8-bit store rmw", 8);
+    fails += (r.errors != 0);
+    bench_store(&r, 2);
+    xil_printf("  16-bit store    ");
+    print_bench_values(&r, "16-bit store narrow", "16-bit store rmw", 16);
+    fails += (r.errors != 0);
+
+    for (i = 0; i < sizeof(records) / sizeof(records[0]); i++) {
+        bench_records(&r, records[i]);
+        xil_printf("  %2d-byte record  ", records[i]);
+        print_bench_values(&r, record_names[i][0], record_names[i][1], 8);
+        fails += (r.errors != 0);
+    }
+    xil_printf("  (cycles per store / per record)\r\n");
+
+    xil_printf("\r\nResult: %s (%d failures)\r\n", fails == 0 ? "PASS" : "FAIL", fails);
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
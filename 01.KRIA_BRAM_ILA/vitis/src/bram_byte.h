@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Byte / Halfword Access
+ *
+ * File: bram_byte.h
+ * Description: BRAM 바이트 쓰기 인에이블(Use_Byte_Write_Enable)을 이용한
+ *              8/16비트 액세스와 바이트 범위 복사
+ *              (협소 AXI 쓰기 vs 읽기-수정-쓰기 비교)
+ ******************************************************************************/
+
+#ifndef BRAM_BYTE_H
+#define BRAM_BYTE_H
+
+#include "xil_types.h"
+#include "bram_test.h"
+
+/* 부분 워드 하나에 허용할 최대 협소 쓰기 수.
+ * 이보다 많이 필요하면 읽기-수정-쓰기 1회로 처리 (메뉴 16 결과로 조정) */
+#ifndef BRAM_BYTE_NARROW_MAX
+#define BRAM_BYTE_NARROW_MAX    2
+#endif
+
+/* 단일 액세스 (byte_offset: BRAM 내 바이트 오프셋, 16비트는 2바이트 정렬) */
+void bram_write8(u32 byte_offset, u8 value);
+void bram_write16(u32 byte_offset, u16 value);
+u8 bram_read8(u32 byte_offset);
+u16 bram_read16(u32 byte_offset);
+
+/* 비교용: 32비트 읽기-수정-쓰기 */
+void bram_write8_rmw(u32 byte_offset, u8 value);
+void bram_write16_rmw(u32 byte_offset, u16 value);
+
+/* 바이트 범위 복사 (정렬 제약 없음) */
+void bram_copy_to_bram(u32 dst_byte, const u8 *src, u32 len);
+void bram_copy_to_bram_rmw(u32 dst_byte, const u8 *src, u32 len);
+void bram_copy_from_bram(u8 *dst, u32 src_byte, u32 len);
+
+/* 메뉴 16 */
+void test_byte_access(void);
+
+#endif /* BRAM_BYTE_H */
@@ -0,0 +1,394 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - ECC / Fault Injection / Scrubber
+ *
+ * File: bram_ecc.c
+ * Description: 오류 주입으로 CE/UE 동작을 확인하고, 스크러버로 전체 BRAM을
+ *              순회하며 정정 가능 오류를 재기록하며, ECC와 스크러빙의
+ *              대역폭 비용을 측정
+ *
+ * 스크러버는 베어메탈 메인 루프에서 협조적으로 동작합니다
+ * (ecc_scrub_step을 전경 작업 사이에 호출). 컨트롤러는 읽기 시 데이터만
+ * 정정하고 메모리를 고치지 않으므로, CE 워드는 정정된 값을 다시 써야 합니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_ecc.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+
+#define ECC_TEST_OFFSET         100
+#define ECC_TEST_VALUE          0x12345678
+#define ECC_CAMPAIGN_SINGLE     32      /* 단일 비트 오류 주입 수 */
+#define ECC_CAMPAIGN_DOUBLE     2       /* 이중 비트 오류 주입 수 */
+#define ECC_BENCH_ROUNDS        64
+#define ECC_FG_BLOCK_WORDS      256     /* 전경 작업 블록 */
+#define ECC_SCRUB_WORDS         32      /* 블록마다 스크럽할 워드 */
+
+static ecc_scrub_stats_t scrub;
+static u32 scrub_cursor;
+
+/*******************************************************************************
+ * 레지스터 접근
+ ******************************************************************************/
+u32 ecc_reg_read(u32 offset)
+{
+    return Xil_In32(BRAM_ECC_CTRL_ADDR + offset);
+}
+
+void ecc_reg_write(u32 offset, u32 value)
+{
+    Xil_Out32(BRAM_ECC_CTRL_ADDR + offset, value);
+}
+
+void ecc_set_checking(int enable)
+{
+    ecc_reg_write(ECC_ONOFF_OFFSET, enable ? 1 : 0);
+}
+
+u32 ecc_status(void)
+{
+    return ecc_reg_read(ECC_STATUS_OFFSET) & (ECC_STATUS_CE | ECC_STATUS_UE);
+}
+
+void ecc_clear_status(void)
+{
+    ecc_reg_write(ECC_STATUS_OFFSET, ECC_STATUS_CE | ECC_STATUS_UE);
+}
+
+u32 ecc_ce_count(void)
+{
+    return ecc_reg_read(ECC_CE_CNT_OFFSET);
+}
+
+/**
+ * @brief 오류 주입 쓰기
+ * @param offset 워드 오프셋
+ * @param value 쓸 데이터 (원래 값)
+ * @param data_mask 반전할 데이터 비트
+ * @param ecc_mask 반전할 ECC 비트 (7비트)
+ *
+ * FI 레지스터는 다음 BRAM 쓰기 한 번에만 적용되고 자동으로 0이 됩니다.
+ */
+void ecc_inject(u32 offset, u32 value, u32 data_mask, u32 ecc_mask)
+{
+    ecc_reg_write(ECC_FI_D_OFFSET, data_mask);
+    ecc_reg_write(ECC_FI_ECC_OFFSET, ecc_mask);
+    Xil_Out32(BRAM_BASE_ADDR + (offset * 4), value);
+}
+
+/*******************************************************************************
+ * 스크러버
+ ******************************************************************************/
+static u32 ffa_to_offset(u32 ffa)
+{
+    return (ffa & (BRAM_SIZE_BYTES - 1)) / 4;
+}
+
+/**
+ * @brief [start, end) 워드 구간 스크럽
+ *
+ * 구간 전체를 읽은 뒤 상태 레지스터를 한 번만 확인합니다. 오류가 있으면
+ * first-failing-address(FFA)로 워드를 찾아 처리하고, 그 다음 워드부터
+ * 다시 읽습니다 (FFA는 상태를 지울 때까지 첫 오류만 기록).
+ */
+static void scrub_range(u32 start, u32 end)
+{
+    u32 pos = start;
+    u32 ue_next = start;            /* 이미 센 UE 다음 위치 (재읽기 중복 방지) */
+    u32 i, st, off, resume;
+    u32 sum = 0;
+
+    ecc_clear_status();
+
+    while (pos < end) {
+        for (i = pos; i < end; i++) {
+            sum += Xil_In32(BRAM_BASE_ADDR + (i * 4));
+        }
+        st = ecc_status();
+        if (st == 0) {
+            break;
+        }
+
+        resume = end;
+        if (st & ECC_STATUS_CE) {
+            /* 읽기 값은 정정된 데이터 → 그대로 재기록하면 메모리가 복구됨 */
+            off = ffa_to_offset(ecc_reg_read(ECC_CE_FFA_OFFSET));
+            Xil_Out32(BRAM_BASE_ADDR + (off * 4), Xil_In32(BRAM_BASE_ADDR + (off * 4)));
+            scrub.corrected++;
+            if (off >= pos && off + 1 < resume) {
+                resume = off + 1;
+            }
+        }
+        if (st & ECC_STATUS_UE) {
+            off = ffa_to_offset(ecc_reg_read(ECC_UE_FFA_OFFSET));
+            if (off >= ue_next) {
+                scrub.uncorrected++;
+                scrub.last_ue_offset = off;
+                ue_next = off + 1;
+            }
+            if (off >= pos && off + 1 < resume) {
+                resume = off + 1;
+            }
+        }
+        ecc_clear_status();
+        pos = resume;
+    }
+
+    scrub.words += end - start;
+    (void)sum;
+}
+
+void ecc_scrub_reset(void)
+{
+    scrub.passes = 0;
+    scrub.words = 0;
+    scrub.corrected = 0;
+    scrub.uncorrected = 0;
+    scrub.last_ue_offset = 0;
+    scrub_cursor = 0;
+}
+
+/**
+ * @brief 커서 위치부터 words 워드 스크럽 (끝에 도달하면 처음으로)
+ */
+void ecc_scrub_step(u32 words)
+{
+    u32 n;
+
+    while (words > 0) {
+        n = BRAM_SIZE_WORDS - scrub_cursor;
+        if (n > words) {
+            n = words;
+        }
+        scrub_range(scrub_cursor, scrub_cursor + n);
+        scrub_cursor += n;
+        words -= n;
+        if (scrub_cursor >= BRAM_SIZE_WORDS) {
+            scrub_cursor = 0;
+            scrub.passes++;
+        }
+    }
+}
+
+void ecc_scrub_pass(void)
+{
+    ecc_scrub_step(BRAM_SIZE_WORDS);
+}
+
+const ecc_scrub_stats_t *ecc_scrub_stats(void)
+{
+    return &scrub;
+}
+
+/*******************************************************************************
+ * 테스트 (메뉴 15)
+ ******************************************************************************/
+/**
+ * @brief 주입 1건: 쓰기 → 읽기 → 상태 확인 → 복구
+ */
+static u32 inject_case(const char *name, u32 data_mask, u32 ecc_mask, u32 expect_status)
+{
+    u32 readback, st, ok;
+
+    ecc_clear_status();
+    ecc_inject(ECC_TEST_OFFSET, ECC_TEST_VALUE, data_mask, ecc_mask);
+    readback = Xil_In32(BRAM_BASE_ADDR + (ECC_TEST_OFFSET * 4));
+    st = ecc_status();
+
+    if (expect_status == ECC_STATUS_CE) {
+        ok = (readback == ECC_TEST_VALUE) && (st == ECC_STATUS_CE);
+    } else {
+        ok = (st & ECC_STATUS_UE) != 0;
+    }
+
+    /* 정상 쓰기로 복구 */
+    Xil_Out32(BRAM_BASE_ADDR + (ECC_TEST_OFFSET * 4), ECC_TEST_VALUE);
+    ecc_clear_status();
+
+    return bench_report(name, ok ? 0 : 1);
+}
+
+/**
+ * @brief 오류 캠페인: 여러 워드에 주입 → 스크럽 → 재스크럽
+ */
+static u32 scrub_campaign(void)
+{
+    const ecc_scrub_stats_t *st = ecc_scrub_stats();
+    u32 i, off, fails = 0;
+    u32 double_off[ECC_CAMPAIGN_DOUBLE];
+    XTime t0, t1;
+
+    bench_bram_verify(0xC0FFEE00);
+
+    for (i = 0; i < ECC_CAMPAIGN_SINGLE; i++) {
+        off = (i * 67 + 13) % BRAM_SIZE_WORDS;
+        ecc_inject(off, Xil_In32(BRAM_BASE_ADDR + (off * 4)), 1U << (i % 32), 0);
+    }
+    for (i = 0; i < ECC_CAMPAIGN_DOUBLE; i++) {
+        off = (i * 1021 + 7) % BRAM_SIZE_WORDS;
+        double_off[i] = off;
+        ecc_inject(off, Xil_In32(BRAM_BASE_ADDR + (off * 4)), 0x3U << (i * 4), 0);
+    }
+
+    ecc_scrub_reset();
+    t0 = bench_now();
+    ecc_scrub_pass();
+    t1 = bench_now();
+    xil_printf("  Pass 1: corrected %d, uncorrected %d, %d us\r\n",
+               st->corrected, st->uncorrected, bench_ticks_to_us(t1 - t0));
+    fails += bench_report("scrub corrects all single-bit errors",
+                          st->corrected == ECC_CAMPAIGN_SINGLE ? 0 : 1);
+    fails += bench_report("scrub reports all double-bit errors",
+                          st->uncorrected == ECC_CAMPAIGN_DOUBLE ? 0 : 1);
+
+    ecc_scrub_reset();
+    ecc_scrub_pass();
+    xil_printf("  Pass 2: corrected %d, uncorrected %d\r\n", st->corrected, st->uncorrected);
+    fails += bench_report("rewritten words stay clean", st->corrected);
+
+    /* UE 워드는 원래 데이터를 알 수 없으므로 새로 기록 */
+    for (i = 0; i < ECC_CAMPAIGN_DOUBLE; i++) {
+        Xil_Out32(BRAM_BASE_ADDR + (double_off[i] * 4), 0);
+    }
+    ecc_scrub_reset();
+    ecc_scrub_pass();
+    fails += bench_report("clean after UE words rewritten",
+                          st->corrected + st->uncorrected);
+    return fails;
+}
+
+/**
+ * @brief 전경 쓰기/읽기 사이에 스크러버를 끼워 넣은 처리량
+ */
+static void throughput_with_scrub(bench_throughput_t *r, u32 rounds)
+{
+    u32 round, i, sum = 0;
+    u32 bytes = rounds * BRAM_SIZE_BYTES;
+    XTime t0;
+
+    t0 = bench_now();
+    for (round = 0; round < rounds; round++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            Xil_Out32(BRAM_BASE_ADDR + (i * 4), i ^ round);
+            if ((i % ECC_FG_BLOCK_WORDS) == ECC_FG_BLOCK_WORDS - 1) {
+                ecc_scrub_step(ECC_SCRUB_WORDS);
+            }
+        }
+    }
+    r->write_mbps_x100 = bench_mbps_x100(bytes, bench_now() - t0);
+
+    t0 = bench_now();
+    for (round = 0; round < rounds; round++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            sum += Xil_In32(BRAM_BASE_ADDR + (i * 4));
+            if ((i % ECC_FG_BLOCK_WORDS) == ECC_FG_BLOCK_WORDS - 1) {
+                ecc_scrub_step(ECC_SCRUB_WORDS);
+            }
+        }
+    }
+    r->read_mbps_x100 = bench_mbps_x100(bytes, bench_now() - t0);
+    (void)sum;
+}
+
+static u32 cost_x100(u32 base_x100, u32 value_x100)
+{
+    if (base_x100 == 0 || value_x100 >= base_x100) {
+        return 0;
+    }
+    return (u32)(((u64)(base_x100 - value_x100) * 10000ULL) / base_x100);
+}
+
+static void print_cost_row(const char *name, const bench_throughput_t *r,
+                           const bench_throughput_t *base)
+{
+    xil_printf("  %-22s ", name);
+    bench_print_x100(r->write_mbps_x100, 7);
+    xil_printf(" / ");
+    bench_print_x100(r->read_mbps_x100, 7);
+    xil_printf(" MB/s   ");
+    bench_print_x100(cost_x100(base->write_mbps_x100, r->write_mbps_x100), 5);
+    xil_printf(" / ");
+    bench_print_x100(cost_x100(base->read_mbps_x100, r->read_mbps_x100), 5);
+    xil_printf(" %%\r\n");
+}
+
+static void bandwidth_cost(void)
+{
+    bench_throughput_t off, on, scrubbed;
+    u32 scrub_us, scrub_mbps_x100;
+    XTime t0;
+
+    ecc_set_checking(0);
+    bench_bram_throughput(&off, ECC_BENCH_ROUNDS);
+    ecc_set_checking(1);
+    bench_bram_throughput(&on, ECC_BENCH_ROUNDS);
+    throughput_with_scrub(&scrubbed, ECC_BENCH_ROUNDS);
+
+    ecc_scrub_reset();
+    t0 = bench_now();
+    ecc_scrub_step(ECC_BENCH_ROUNDS * BRAM_SIZE_WORDS);
+    t0 = bench_now() - t0;
+    scrub_us = bench_ticks_to_us(t0) / ECC_BENCH_ROUNDS;
+    scrub_mbps_x100 = bench_mbps_x100(ECC_BENCH_ROUNDS * BRAM_SIZE_BYTES, t0);
+
+    bench_result_add("ecc off", 32, 0, off.write_mbps_x100, off.read_mbps_x100, NULL);
+    bench_result_add("ecc on", 32, 0, on.write_mbps_x100, on.read_mbps_x100, NULL);
+    bench_result_add("ecc on + scrubber", 32, 0,
+                     scrubbed.write_mbps_x100, scrubbed.read_mbps_x100, NULL);
+
+    xil_printf("  Mode                     Write /    Read        Cost vs ECC off (W / R)\r\n");
+    print_cost_row("ECC checking off", &off, &off);
+    print_cost_row("ECC checking on", &on, &off);
+    print_cost_row("ECC on + scrubber", &scrubbed, &off);
+    xil_printf("  Scrubber: %d words per %d foreground words\r\n",
+               ECC_SCRUB_WORDS, ECC_FG_BLOCK_WORDS);
+    xil_printf("  Scrub pass alone: %d us per 8KB (", scrub_us);
+    bench_print_x100(scrub_mbps_x100, 0);
+    xil_printf(" MB/s)\r\n");
+}
+
+/**
+ * @brief ECC 테스트 메뉴: 주입 → 스크럽 → 대역폭 비용
+ */
+void test_ecc(void)
+{
+    u32 fails = 0;
+    u32 ce_before;
+
+    xil_printf("=== BRAM ECC Test ===\r\n");
+#if !BRAM_ECC_ENABLED
+    xil_printf("ECC is not enabled in this build.\r\n");
+    xil_printf("Rebuild the bitstream with create_project.tcl -ecc 1 and\r\n");
+    xil_printf("define BRAM_ECC_ENABLED=1 in the Vitis symbols.\r\n");
+    return;
+#endif
+
+    xil_printf("Controller registers: 0x%08X\r\n", BRAM_ECC_CTRL_ADDR);
+    ecc_set_checking(1);
+    ecc_clear_status();
+    ecc_reg_write(ECC_CE_CNT_OFFSET, 0);
+    bench_bram_verify(0x5EC0DE00);
+
+    xil_printf("\r\n[1] Fault injection (offset %d)\r\n", ECC_TEST_OFFSET);
+    ce_before = ecc_ce_count();
+    fails += inject_case("single-bit data error corrected", 1U << 5, 0, ECC_STATUS_CE);
+    fails += inject_case("single-bit ECC error corrected", 0, 0x01, ECC_STATUS_CE);
+    fails += inject_case("double-bit error detected (UE)", 0x3U << 9, 0, ECC_STATUS_UE);
+    fails += bench_report("CE counter advanced", ecc_ce_count() - ce_before >= 2 ? 0 : 1);
+
+    xil_printf("\r\n[2] Scrubber (%d single + %d double-bit errors)\r\n",
+               ECC_CAMPAIGN_SINGLE, ECC_CAMPAIGN_DOUBLE);
+    fails += scrub_campaign();
+
+    xil_printf("\r\n[3] Bandwidth cost (%d x 8KB)\r\n", ECC_BENCH_ROUNDS);
+    bench_result_begin("ecc");
+    bandwidth_cost();
+
+    xil_printf("\r\nCE counter: %d\r\n", ecc_ce_count());
+    xil_printf("Result: %s (%d failures)\r\n", fails == 0 ? "PASS" : "FAIL", fails);
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - ECC / Fault Injection / Scrubber
+ *
+ * File: bram_ecc.h
+ * Description: AXI BRAM Controller ECC 레지스터(PG078) 접근,
+ *              단일/이중 비트 오류 주입, BRAM 스크러버
+ *              (create_project.tcl -ecc 1 로 빌드한 비트스트림 필요)
+ ******************************************************************************/
+
+#ifndef BRAM_ECC_H
+#define BRAM_ECC_H
+
+#include "xil_types.h"
+#include "bram_test.h"
+
+/*******************************************************************************
+ * ECC 레지스터 (S_AXI_CTRL 오프셋)
+ ******************************************************************************/
+#define ECC_STATUS_OFFSET       0x000   /* [1] CE, [0] UE (W1C) */
+#define ECC_EN_IRQ_OFFSET       0x004
+#define ECC_ONOFF_OFFSET        0x008   /* [0] 1 = ECC 검사 ON */
+#define ECC_CE_CNT_OFFSET       0x00C   /* 정정 가능 오류 카운터 (포화) */
+#define ECC_CE_FFD_OFFSET       0x100   /* 첫 CE 데이터 */
+#define ECC_CE_FFE_OFFSET       0x180   /* 첫 CE ECC 비트 */
+#define ECC_CE_FFA_OFFSET       0x1C0   /* 첫 CE 주소 */
+#define ECC_UE_FFD_OFFSET       0x200
+#define ECC_UE_FFE_OFFSET       0x280
+#define ECC_UE_FFA_OFFSET       0x2C0
+#define ECC_FI_D_OFFSET         0x300   /* 다음 쓰기에서 반전할 데이터 비트 */
+#define ECC_FI_ECC_OFFSET       0x380   /* 다음 쓰기에서 반전할 ECC 비트 */
+
+#define ECC_STATUS_UE           0x1
+#define ECC_STATUS_CE           0x2
+
+/*******************************************************************************
+ * 스크러버
+ ******************************************************************************/
+/* 스크러버 누적 통계 */
+typedef struct {
+    u32 passes;             /* 전체 BRAM 순회 완료 횟수 */
+    u32 words;              /* 읽은 워드 수 */
+    u32 corrected;          /* CE 발견 후 정정 데이터 재기록 */
+    u32 uncorrected;        /* UE 발견 (재기록 불가) */
+    u32 last_ue_offset;     /* 마지막 UE 워드 오프셋 */
+} ecc_scrub_stats_t;
+
+u32 ecc_reg_read(u32 offset);
+void ecc_reg_write(u32 offset, u32 value);
+
+void ecc_set_checking(int enable);
+u32 ecc_status(void);
+void ecc_clear_status(void);
+u32 ecc_ce_count(void);
+
+/* offset 워드에 value를 쓰면서 data_mask / ecc_mask 비트를 반전 */
+void ecc_inject(u32 offset, u32 value, u32 data_mask, u32 ecc_mask);
+
+/* 스크러버: 커서 위치부터 words 워드를 읽고 CE는 재기록으로 정정 */
+void ecc_scrub_reset(void);
+void ecc_scrub_step(u32 words);
+void ecc_scrub_pass(void);
+const ecc_scrub_stats_t *ecc_scrub_stats(void);
+
+/* 메뉴 15 */
+void test_ecc(void);
+
+#endif /* BRAM_ECC_H */
@@ -0,0 +1,452 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Access Pattern Matrix
+ *
+ * File: bram_matrix.c
+ * Description: 액세스 패턴 커널 모음과 지연/대역폭 행렬 (메뉴 19, 헤드리스 0x40)
+ *
+ * 커널은 BRAM 전체(폭에 따라 8192 / 4096 / 2048 요소)를 repeats번 순회합니다.
+ *   seq      : 0, 1, 2, ...
+ *   stride   : s, s+k, s+2k, ... (s = 0..k-1, 모든 요소 1회)
+ *   random   : DDR 순열 테이블 순서 (각 액세스는 서로 독립)
+ *   chase    : BRAM에 기록한 다음 인덱스를 따라감 (앞 읽기 결과가 다음 주소,
+ *              읽기 왕복 지연이 그대로 드러남, 인덱스가 8비트에 안 들어가므로 16/32비트만)
+ *   raw      : 쓰기 직후 같은 주소 읽기 (쓰기 응답 → 읽기 순서 의존)
+ *   war      : 읽기 후 같은 주소에 +1 쓰기
+ * 폭은 컴파일 타임 상수로 인라인되어 루프 안에서 분기하지 않습니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+#include "bram_matrix.h"
+
+enum {
+    MK_SEQ_RD,
+    MK_SEQ_WR,
+    MK_STRIDE_RD,
+    MK_STRIDE_WR,
+    MK_RAND_RD,
+    MK_RAND_WR,
+    MK_CHASE,
+    MK_RAW,
+    MK_WAR,
+    MK_COUNT
+};
+
+typedef struct {
+    const char *name;
+    u32 reads;          /* 요소당 읽기 수 */
+    u32 writes;         /* 요소당 쓰기 수 */
+} matrix_kernel_t;
+
+static const matrix_kernel_t matrix_kernels[MK_COUNT] = {
+    {"seq read",      1, 0},
+    {"seq write",     0, 1},
+    {"stride read",   1, 0},
+    {"stride write",  0, 1},
+    {"random read",   1, 0},
+    {"random write",  0, 1},
+    {"chase",         1, 0},
+    {"raw",           1, 1},
+    {"war",           1, 1},
+};
+
+static const u32 matrix_widths[3] = {1, 2, 4};     /* 바이트 */
+
+typedef struct {
+    u32 ns_x100;        /* 액세스당 ns x 100 */
+    u32 mbps_x100;      /* 전체 트래픽 MB/s x 100 */
+} matrix_cell_t;
+
+static u16 matrix_perm[BRAM_SIZE_BYTES];            /* 8비트 기준 최대 8192 요소 */
+static matrix_cell_t matrix_cells[MK_COUNT][3];
+
+/* stride 커널 레코드 케이스 이름 ("stride read s64", 실제 stride 바이트 포함).
+ * bench_result_flush()까지 포인터가 유지되어야 하므로 정적 버퍼 */
+static char matrix_stride_case[2][3][24];
+
+/*******************************************************************************
+ * 폭별 액세스 (w는 항상 상수로 인라인됨)
+ ******************************************************************************/
+static inline __attribute__((always_inline)) u32 mx_read(u32 index, u32 w)
+{
+    UINTPTR a = BRAM_BASE_ADDR + (index * w);
+
+    if (w == 1) {
+        return Xil_In8(a);
+    }
+    if (w == 2) {
+        return Xil_In16(a);
+    }
+    return Xil_In32(a);
+}
+
+static inline __attribute__((always_inline)) void mx_write(u32 index, u32 value, u32 w)
+{
+    UINTPTR a = BRAM_BASE_ADDR + (index * w);
+
+    if (w == 1) {
+        Xil_Out8(a, (u8)value);
+    } else if (w == 2) {
+        Xil_Out16(a, (u16)value);
+    } else {
+        Xil_Out32(a, value);
+    }
+}
+
+static inline u32 width_mask(u32 w)
+{
+    return (w == 4) ? 0xFFFFFFFFU : ((1U << (w * 8)) - 1);
+}
+
+/**
+ * @brief "<커널 이름> s<stride 바이트>" 케이스 이름 생성
+ *
+ * stride가 다른 실행이 같은 bench_history 키로 비교되지 않도록
+ * 레코드 케이스에 실제 stride(요소 간격 x 폭)를 넣습니다.
+ */
+static const char *stride_case(char *buf, u32 size, const char *name, u32 stride_bytes)
+{
+    char digits[10];
+    u32 i = 0, n = 0;
+
+    while (name[i] != '\0' && i + 3 < size) {
+        buf[i] = name[i];
+        i++;
+    }
+    do {
+        digits[n++] = (char)('0' + (stride_bytes % 10));
+        stride_bytes /= 10;
+    } while (stride_bytes != 0 && n < sizeof(digits));
+    if (i + 2 + n < size) {
+        buf[i++] = ' ';
+        buf[i++] = 's';
+        while (n > 0) {
+            buf[i++] = digits[--n];
+        }
+    }
+    buf[i] = '\0';
+    return buf;
+}
+
+/*******************************************************************************
+ * 커널
+ ******************************************************************************/
+/**
+ * @brief 커널 하나를 repeats번 실행
+ * @return RAW 읽기값 불일치 수 / chase가 시작점으로 돌아오지 않은 횟수
+ */
+static inline __attribute__((always_inline))
+u32 kernel_body(u32 k, u32 w, u32 n, u32 repeats, u32 stride)
+{
+    u32 mask = width_mask(w);
+    u32 r, s, i, v, idx = 0, sum = 0, errors = 0;
+
+    switch (k) {
+        case MK_SEQ_RD:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    sum += mx_read(i, w);
+                }
+            }
+            break;
+        case MK_SEQ_WR:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    mx_write(i, i ^ r, w);
+                }
+            }
+            break;
+        case MK_STRIDE_RD:
+            for (r = 0; r < repeats; r++) {
+                for (s = 0; s < stride; s++) {
+                    for (i = s; i < n; i += stride) {
+                        sum += mx_read(i, w);
+                    }
+                }
+            }
+            break;
+        case MK_STRIDE_WR:
+            for (r = 0; r < repeats; r++) {
+                for (s = 0; s < stride; s++) {
+                    for (i = s; i < n; i += stride) {
+                        mx_write(i, i ^ r, w);
+                    }
+                }
+            }
+            break;
+        case MK_RAND_RD:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    sum += mx_read(matrix_perm[i], w);
+                }
+            }
+            break;
+        case MK_RAND_WR:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    mx_write(matrix_perm[i], i ^ r, w);
+                }
+            }
+            break;
+        case MK_CHASE:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    idx = mx_read(idx, w);
+                }
+                if (idx != 0) {
+                    errors++;
+                    idx = 0;
+                }
+            }
+            break;
+        case MK_RAW:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    v = ((i * 0x9E3779B1U) ^ r) & mask;
+                    mx_write(i, v, w);
+                    if (mx_read(i, w) != v) {
+                        errors++;
+                    }
+                }
+            }
+            break;
+        case MK_WAR:
+            for (r = 0; r < repeats; r++) {
+                for (i = 0; i < n; i++) {
+                    v = mx_read(i, w);
+                    mx_write(i, v + 1, w);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    (void)sum;
+    return errors;
+}
+
+static BRAM_HOT u32 run_kernel(u32 k, u32 w, u32 n, u32 repeats, u32 stride)
+{
+    switch (w) {
+        case 1:  return kernel_body(k, 1, n, repeats, stride);
+        case 2:  return kernel_body(k, 2, n, repeats, stride);
+        default: return kernel_body(k, 4, n, repeats, stride);
+    }
+}
+
+/*******************************************************************************
+ * 준비 / 사후 검사 (측정 구간 밖)
+ ******************************************************************************/
+/**
+ * @brief 0..n-1 무작위 순열 (Fisher-Yates, 고정 시드로 재현 가능)
+ */
+static void build_perm(u32 n)
+{
+    u32 x = 0x2545F491U;
+    u32 i, j;
+    u16 t;
+
+    for (i = 0; i < n; i++) {
+        matrix_perm[i] = (u16)i;
+    }
+    for (i = n - 1; i > 0; i--) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        j = x % (i + 1);
+        t = matrix_perm[i];
+        matrix_perm[i] = matrix_perm[j];
+        matrix_perm[j] = t;
+    }
+}
+
+/**
+ * @brief 순열 순서로 하나의 순환을 BRAM에 기록 (요소 = 다음 인덱스)
+ */
+static void prepare_chase(u32 w, u32 n)
+{
+    u32 j;
+
+    for (j = 0; j < n; j++) {
+        mx_write(matrix_perm[j], matrix_perm[(j + 1) % n], w);
+    }
+}
+
+static void fill_index(u32 w, u32 n)
+{
+    u32 i;
+
+    for (i = 0; i < n; i++) {
+        mx_write(i, i, w);
+    }
+}
+
+static u32 check_war(u32 w, u32 n, u32 repeats)
+{
+    u32 mask = width_mask(w);
+    u32 i, errors = 0;
+
+    for (i = 0; i < n; i++) {
+        if (mx_read(i, w) != ((i + repeats) & mask)) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/*******************************************************************************
+ * 행렬
+ ******************************************************************************/
+static void print_matrix(const char *title, u32 col_mask, int mbps)
+{
+    u32 k, c;
+    const matrix_cell_t *cell;
+
+    xil_printf("\r\n  %-16s", title);
+    for (c = 0; c < 3; c++) {
+        if (col_mask & (1U << c)) {
+            xil_printf("  %6d-bit", matrix_widths[c] * 8);
+        }
+    }
+    xil_printf("\r\n");
+    for (k = 0; k < MK_COUNT; k++) {
+        xil_printf("  %-16s", matrix_kernels[k].name);
+        for (c = 0; c < 3; c++) {
+            if (!(col_mask & (1U << c))) {
+                continue;
+            }
+            cell = &matrix_cells[k][c];
+            if (cell->mbps_x100 == BENCH_NONE) {
+                xil_printf("  %10s", "-");
+            } else {
+                xil_printf("  ");
+                bench_print_x100(mbps ? cell->mbps_x100 : cell->ns_x100, 10);
+            }
+        }
+        xil_printf("\r\n");
+    }
+}
+
+u32 matrix_run(const matrix_cfg_t *cfg, int verbose)
+{
+    const matrix_kernel_t *mk;
+    matrix_cell_t *cell;
+    u32 c, k, w, n, stride, accesses, errors, total_errors = 0;
+    u32 rd_x100, wr_x100;
+    const char *name;
+    XTime t;
+
+    bench_result_begin("matrix");
+    for (c = 0; c < 3; c++) {
+        if (!(cfg->widths & (1U << c))) {
+            continue;
+        }
+        w = matrix_widths[c];
+        n = BRAM_SIZE_BYTES / w;
+        stride = cfg->stride_bytes / w;
+        if (stride == 0) {
+            stride = 1;
+        } else if (stride > n) {
+            stride = n;
+        }
+        build_perm(n);
+
+        for (k = 0; k < MK_COUNT; k++) {
+            mk = &matrix_kernels[k];
+            cell = &matrix_cells[k][c];
+            if (k == MK_CHASE && w == 1) {
+                cell->ns_x100 = BENCH_NONE;
+                cell->mbps_x100 = BENCH_NONE;
+                continue;
+            }
+            if (k == MK_CHASE) {
+                prepare_chase(w, n);
+            } else if (k == MK_WAR) {
+                fill_index(w, n);
+            }
+
+            t = bench_now();
+            errors = run_kernel(k, w, n, cfg->repeats, stride);
+            t = bench_now() - t;
+
+            if (k == MK_WAR) {
+                errors += check_war(w, n, cfg->repeats);
+            }
+            total_errors += errors;
+
+            accesses = n * cfg->repeats * (mk->reads + mk->writes);
+            cell->ns_x100 = (u32)((((u64)t * 1000000000ULL) / COUNTS_PER_SECOND) * 100 / accesses);
+            cell->mbps_x100 = bench_mbps_x100(accesses * w, t);
+
+            /* 방향별 MB/s (RAW/WAR는 같은 시간 동안 양방향) */
+            rd_x100 = mk->reads ? bench_mbps_x100(n * cfg->repeats * mk->reads * w, t) : BENCH_NONE;
+            wr_x100 = mk->writes ? bench_mbps_x100(n * cfg->repeats * mk->writes * w, t) : BENCH_NONE;
+            name = mk->name;
+            if (k == MK_STRIDE_RD || k == MK_STRIDE_WR) {
+                name = stride_case(matrix_stride_case[k - MK_STRIDE_RD][c],
+                                   sizeof(matrix_stride_case[0][0]), mk->name, stride * w);
+            }
+            bench_result_add(name, w * 8, 0, wr_x100, rd_x100, NULL);
+
+            if (verbose && errors != 0) {
+                xil_printf("  %s %d-bit: %d data errors\r\n", mk->name, w * 8, errors);
+            }
+        }
+    }
+
+    if (verbose) {
+        print_matrix("ns / access", cfg->widths, 0);
+        print_matrix("MB/s", cfg->widths, 1);
+    }
+    bench_result_flush();
+    return total_errors;
+}
+
+/*******************************************************************************
+ * 메뉴 19
+ ******************************************************************************/
+/**
+ * @brief 폭 / 반복 / stride를 입력받아 행렬 실행 (0 입력 = 기본값)
+ */
+void test_access_matrix(void)
+{
+    matrix_cfg_t cfg;
+    u32 width, errors;
+
+    xil_printf("=== Access Pattern Matrix ===\r\n");
+    width = get_dec_input("Width in bits (8/16/32, 0 = all): ");
+    switch (width) {
+        case 0:  cfg.widths = MATRIX_ALL_WIDTHS; break;
+        case 8:  cfg.widths = MATRIX_W8; break;
+        case 16: cfg.widths = MATRIX_W16; break;
+        case 32: cfg.widths = MATRIX_W32; break;
+        default:
+            xil_printf("Error: width must be 8, 16 or 32\r\n");
+            return;
+    }
+    cfg.repeats = get_dec_input("Repeat count (1-64, 0 = 4): ");
+    if (cfg.repeats == 0) {
+        cfg.repeats = MATRIX_DEFAULT_REPEATS;
+    } else if (cfg.repeats > MATRIX_MAX_REPEATS) {
+        xil_printf("Error: repeat count must be 1-%d\r\n", MATRIX_MAX_REPEATS);
+        return;
+    }
+    cfg.stride_bytes = get_dec_input("Stride in bytes (0 = 64): ");
+    if (cfg.stride_bytes == 0) {
+        cfg.stride_bytes = MATRIX_DEFAULT_STRIDE;
+    }
+
+    xil_printf("\r\n%d repeats over %d KB, stride %d bytes, random/chase seed fixed\r\n",
+               cfg.repeats, BRAM_SIZE_BYTES / 1024, cfg.stride_bytes);
+    errors = matrix_run(&cfg, 1);
+    xil_printf("\r\nData checks (raw / war / chase): %s", errors == 0 ? "PASS" : "FAIL");
+    if (errors != 0) {
+        xil_printf(" (%d errors)", errors);
+    }
+    xil_printf("\r\n");
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Access Pattern Matrix
+ *
+ * File: bram_matrix.h
+ * Description: 순차 / 고정 stride / 랜덤 순열 / pointer-chase /
+ *              read-after-write / write-after-read 커널을 BRAM 전체에 대해
+ *              8/16/32비트 폭으로 실행하고 지연(ns/access)·대역폭(MB/s) 행렬 출력
+ ******************************************************************************/
+
+#ifndef BRAM_MATRIX_H
+#define BRAM_MATRIX_H
+
+#include "xil_types.h"
+
+/* 폭 선택 비트 */
+#define MATRIX_W8               (1U << 0)
+#define MATRIX_W16              (1U << 1)
+#define MATRIX_W32              (1U << 2)
+#define MATRIX_ALL_WIDTHS       (MATRIX_W8 | MATRIX_W16 | MATRIX_W32)
+
+#define MATRIX_DEFAULT_REPEATS  4
+#define MATRIX_MAX_REPEATS      64
+#define MATRIX_DEFAULT_STRIDE   64      /* 바이트 */
+
+typedef struct {
+    u32 widths;         /* MATRIX_W* 조합 */
+    u32 repeats;        /* 커널마다 BRAM 전체를 반복할 횟수 */
+    u32 stride_bytes;   /* stride 커널 간격 (폭보다 작으면 1 요소) */
+} matrix_cfg_t;
+
+/**
+ * @brief 커널 × 폭 행렬 실행, "matrix" 레코드 출력
+ * @param verbose 0이면 표 없이 @BENCH 레코드만 출력 (헤드리스)
+ * @return 데이터 검사 오류 수 (RAW 읽기값, WAR 결과, chase 순환)
+ */
+u32 matrix_run(const matrix_cfg_t *cfg, int verbose);
+
+/* 메뉴 19 */
+void test_access_matrix(void);
+
+#endif /* BRAM_MATRIX_H */
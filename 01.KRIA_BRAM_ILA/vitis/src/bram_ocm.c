@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Run-from-OCM Profile
+ *
+ * File: bram_ocm.c
+ * Description: OCM 코드 섹션 복사, 같은 BRAM 루프를 DDR 코드와 OCM 코드로
+ *              각각 실행해 32비트 워드당 CPU 사이클 비교
+ *
+ * lscript_ocm.ld는 .ocm_text 섹션을 OCM에서 실행하도록 링크하고(VMA)
+ * DDR에 저장(LMA)하므로, 시작 시 한 번 복사해야 합니다. 기본 링커 스크립트로
+ * 빌드하면 심볼이 없어(weak = 0) 복사하지 않고 모든 코드가 DDR에서 실행됩니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+#include "bram_ocm.h"
+
+#define OCM_BENCH_ROUNDS    32
+#define OCM_STACK_BUF_WORDS 64
+
+/* lscript_ocm.ld가 정의 (기본 프로파일에서는 0) */
+extern u8 __ocm_text_start[] __attribute__((weak));
+extern u8 __ocm_text_end[] __attribute__((weak));
+extern u8 __ocm_text_load[] __attribute__((weak));
+
+static u32 ocm_copied;
+
+/**
+ * @brief .ocm_text를 DDR 저장 위치에서 OCM 실행 위치로 복사
+ *
+ * BRAM_HOT 함수를 호출하기 전에 실행해야 하며, 이 함수 자신은 DDR에 있습니다.
+ */
+u32 bram_ocm_init(void)
+{
+    const u8 *src = __ocm_text_load;
+    u8 *dst = __ocm_text_start;
+    u32 i, size;
+
+    if (dst == NULL || src == NULL || src == dst) {
+        return 0;
+    }
+    size = (u32)(__ocm_text_end - __ocm_text_start);
+    for (i = 0; i < size; i++) {
+        dst[i] = src[i];
+    }
+
+    /* D-Cache가 켜져 있으면 먼저 OCM으로 내보낸 뒤 I-Cache 무효화 */
+    Xil_DCacheFlushRange((UINTPTR)dst, size);
+    Xil_ICacheInvalidate();
+
+    ocm_copied = size;
+    return size;
+}
+
+static const char *region_of(UINTPTR addr)
+{
+    if (addr >= OCM_BASE_ADDR && addr - OCM_BASE_ADDR < OCM_SIZE_BYTES) {
+        return "OCM";
+    }
+    return "DDR";
+}
+
+/*******************************************************************************
+ * 측정 커널 (본문은 하나, 배치만 다른 두 복사본)
+ ******************************************************************************/
+static inline __attribute__((always_inline)) void write_loop_body(u32 rounds)
+{
+    u32 r, i;
+
+    for (r = 0; r < rounds; r++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            Xil_Out32(BRAM_BASE_ADDR + (i * 4), i ^ r);
+        }
+    }
+}
+
+static inline __attribute__((always_inline)) u32 read_loop_body(u32 rounds)
+{
+    u32 r, i, sum = 0;
+
+    for (r = 0; r < rounds; r++) {
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            sum += Xil_In32(BRAM_BASE_ADDR + (i * 4));
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief BRAM → 스택 버퍼 → BRAM (스택 위치에 따라 비용이 달라짐)
+ */
+static inline __attribute__((always_inline)) u32 stack_loop_body(u32 rounds)
+{
+    u32 buf[OCM_STACK_BUF_WORDS];
+    u32 r, i, blk, sum = 0;
+
+    for (r = 0; r < rounds; r++) {
+        for (blk = 0; blk < BRAM_SIZE_WORDS; blk += OCM_STACK_BUF_WORDS) {
+            for (i = 0; i < OCM_STACK_BUF_WORDS; i++) {
+                buf[i] = Xil_In32(BRAM_BASE_ADDR + ((blk + i) * 4));
+            }
+            for (i = 0; i < OCM_STACK_BUF_WORDS; i++) {
+                sum += buf[i];
+                Xil_Out32(BRAM_BASE_ADDR + ((blk + i) * 4), buf[i] + 1);
+            }
+        }
+    }
+    return sum;
+}
+
+static __attribute__((noinline)) void write_loop_ddr(u32 rounds) { write_loop_body(rounds); }
+static __attribute__((noinline)) u32 read_loop_ddr(u32 rounds) { return read_loop_body(rounds); }
+static __attribute__((noinline)) u32 stack_loop_ddr(u32 rounds) { return stack_loop_body(rounds); }
+
+static BRAM_HOT void write_loop_ocm(u32 rounds) { write_loop_body(rounds); }
+static BRAM_HOT u32 read_loop_ocm(u32 rounds) { return read_loop_body(rounds); }
+static BRAM_HOT u32 stack_loop_ocm(u32 rounds) { return stack_loop_body(rounds); }
+
+typedef struct {
+    const char *name;
+    const char *ddr_record;
+    const char *ocm_record;
+    void (*write_fn[2])(u32);
+    u32 (*read_fn[2])(u32);
+    u32 words_per_round;         /* 워드 액세스 수 (읽기 + 쓰기) */
+} ocm_kernel_t;
+
+static const ocm_kernel_t ocm_kernels[] = {
+    {"write loop",          "write loop ddr", "write loop ocm",
+     {write_loop_ddr, write_loop_ocm}, {NULL, NULL}, BRAM_SIZE_WORDS},
+    {"read loop",           "read loop ddr", "read loop ocm",
+     {NULL, NULL}, {read_loop_ddr, read_loop_ocm}, BRAM_SIZE_WORDS},
+    {"read->stack->write",  "stack copy ddr", "stack copy ocm",
+     {NULL, NULL}, {stack_loop_ddr, stack_loop_ocm}, BRAM_SIZE_WORDS * 2},
+};
+
+static XTime run_kernel(const ocm_kernel_t *k, u32 where)
+{
+    XTime t0;
+    u32 sum = 0;
+
+    /* 1라운드 예열 (I-Cache 채우기) */
+    if (k->write_fn[where] != NULL) {
+        k->write_fn[where](1);
+    } else {
+        sum = k->read_fn[where](1);
+    }
+
+    t0 = bench_now();
+    if (k->write_fn[where] != NULL) {
+        k->write_fn[where](OCM_BENCH_ROUNDS);
+    } else {
+        sum = k->read_fn[where](OCM_BENCH_ROUNDS);
+    }
+    (void)sum;
+    return bench_now() - t0;
+}
+
+/*******************************************************************************
+ * 메뉴 17
+ ******************************************************************************/
+/**
+ * @brief DDR 코드 / OCM 코드로 같은 루프를 실행한 워드당 사이클 비교
+ */
+void test_ocm_bench(void)
+{
+    u32 probe = 0;
+    u32 i, where, words, cyc[2];
+    XTime t;
+    const ocm_kernel_t *k;
+
+    xil_printf("=== OCM vs DDR Loop Cost ===\r\n");
+    if (ocm_copied != 0) {
+        xil_printf("Profile: run-from-OCM (%d bytes of hot code at 0x%08X)\r\n",
+                   ocm_copied, (u32)(UINTPTR)__ocm_text_start);
+    } else {
+        xil_printf("Profile: default (all code in DDR, link with lscript_ocm.ld for OCM)\r\n");
+    }
+    xil_printf("Stack:   0x%08X (%s)\r\n", (u32)(UINTPTR)&probe, region_of((UINTPTR)&probe));
+    xil_printf("Code:    DDR copy 0x%08X (%s), OCM copy 0x%08X (%s)\r\n",
+               (u32)(UINTPTR)write_loop_ddr, region_of((UINTPTR)write_loop_ddr),
+               (u32)(UINTPTR)write_loop_ocm, region_of((UINTPTR)write_loop_ocm));
+    xil_printf("%d rounds x %d KB, CPU cycles per 32-bit BRAM access\r\n\r\n",
+               OCM_BENCH_ROUNDS, BRAM_SIZE_BYTES / 1024);
+
+    xil_printf("Kernel                  DDR code   OCM code   Saved\r\n");
+    xil_printf("----------------------  ---------  ---------  ---------\r\n");
+
+    bench_result_begin("ocm");
+    for (i = 0; i < sizeof(ocm_kernels) / sizeof(ocm_kernels[0]); i++) {
+        k = &ocm_kernels[i];
+        words = OCM_BENCH_ROUNDS * k->words_per_round;
+        for (where = 0; where < 2; where++) {
+            t = run_kernel(k, where);
+            cyc[where] = bench_cycles_per_word_x100(t, words);
+            bench_result_add(where == 0 ? k->ddr_record : k->ocm_record, 32, 0,
+                             k->write_fn[where] != NULL ? bench_mbps_x100(words * 4, t) : BENCH_NONE,
+                             k->write_fn[where] == NULL ? bench_mbps_x100(words * 4, t) : BENCH_NONE,
+                             NULL);
+        }
+        xil_printf("%-22s  ", k->name);
+        bench_print_x100(cyc[0], 9);
+        xil_printf("  ");
+        bench_print_x100(cyc[1], 9);
+        xil_printf("  ");
+        bench_print_x100(cyc[0] > cyc[1] ? cyc[0] - cyc[1] : 0, 9);
+        xil_printf("\r\n");
+    }
+
+    xil_printf("\r\nD-Cache is disabled in the menu build: every stack access and\r\n");
+    xil_printf("I-cache refill goes to the memory the linker profile placed it in.\r\n");
+    xil_printf("Both columns share the %s stack above, so this table compares code\r\n",
+               region_of((UINTPTR)&probe));
+    xil_printf("placement only. For the stack effect, compare the \"stack copy\" records\r\n");
+    xil_printf("of a default-profile run (DDR stack) and an lscript_ocm.ld run (OCM stack).\r\n");
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
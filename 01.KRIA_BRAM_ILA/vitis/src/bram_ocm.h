@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Run-from-OCM Profile
+ *
+ * File: bram_ocm.h
+ * Description: lscript_ocm.ld 프로파일의 OCM 코드 복사와
+ *              DDR / OCM 실행 시 BRAM 루프의 워드당 비용 비교
+ ******************************************************************************/
+
+#ifndef BRAM_OCM_H
+#define BRAM_OCM_H
+
+#include "xil_types.h"
+
+#define OCM_BASE_ADDR       0xFFFC0000U
+#define OCM_SIZE_BYTES      (256 * 1024)
+
+/* main() 시작 시 호출 - BRAM_HOT 코드를 OCM으로 복사 (반환: 복사한 바이트, 기본 프로파일은 0) */
+u32 bram_ocm_init(void);
+
+/* 메뉴 17 */
+void test_ocm_bench(void);
+
+#endif /* BRAM_OCM_H */
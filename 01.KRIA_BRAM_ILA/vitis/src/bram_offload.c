@@ -0,0 +1,311 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - PL 벡터 커널 오프로드
+ *
+ * File: bram_offload.c
+ * Description: 벡터 연산(add / scale / min-max / histogram)을 BRAM 포트 B의
+ *              HLS 커널과 A53(포트 A, AXI 단일 액세스)으로 각각 실행해
+ *              결과 일치와 실행 시간을 비교 (메뉴 23)
+ *
+ * A53 구현은 커널 소스와 독립적으로 작성되어 있어 서로의 검증 기준이 됩니다.
+ * 커널 시간은 인자 쓰기 + ap_start부터 ap_done 확인까지이므로 AXI-Lite
+ * 왕복(호출 오버헤드)이 포함되며, 메뉴 23은 count = 0 호출로 이를 따로 보여 줍니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+#include "bram_offload.h"
+
+#define VEC_TIMEOUT_US          100000
+#define VEC_SEED                0x2545F491U
+#define VEC_NUM_OPS             4
+
+static u32 cpu_img[BRAM_SIZE_WORDS];
+static u32 pl_img[BRAM_SIZE_WORDS];
+
+/*******************************************************************************
+ * 레지스터 접근
+ ******************************************************************************/
+static u32 vec_reg_read(u32 offset)
+{
+    return Xil_In32(BRAM_KERNEL_CTRL_ADDR + offset);
+}
+
+static void vec_reg_write(u32 offset, u32 value)
+{
+    Xil_Out32(BRAM_KERNEL_CTRL_ADDR + offset, value);
+}
+
+static int range_ok(u32 start, u32 words)
+{
+    return start <= BRAM_SIZE_WORDS && words <= BRAM_SIZE_WORDS - start;
+}
+
+int vec_op_valid(const vec_op_t *op)
+{
+    if (!range_ok(op->base, op->count)) {
+        return 0;
+    }
+    switch (op->op) {
+        case VEC_OP_ADD:
+            return range_ok(op->arg_a, op->count);
+        case VEC_OP_SCALE:
+            return 1;
+        case VEC_OP_MINMAX:
+            return range_ok(op->dst, 2);
+        case VEC_OP_HIST:
+            return op->arg_a >= 1 && op->arg_a <= VEC_HIST_MAX_BINS &&
+                   range_ok(op->dst, op->arg_a);
+        default:
+            return 0;
+    }
+}
+
+int vec_kernel_present(void)
+{
+    return (vec_reg_read(VEC_AP_CTRL_OFFSET) & VEC_AP_IDLE) != 0;
+}
+
+/*******************************************************************************
+ * 커널 실행
+ ******************************************************************************/
+XTime vec_kernel_run(const vec_op_t *op)
+{
+    XTime t0, t, limit;
+
+    if (!vec_op_valid(op)) {
+        return 0;
+    }
+    limit = ((XTime)VEC_TIMEOUT_US * COUNTS_PER_SECOND) / 1000000;
+
+    t0 = bench_now();
+    vec_reg_write(VEC_OP_OFFSET, op->op);
+    vec_reg_write(VEC_BASE_OFFSET, op->base);
+    vec_reg_write(VEC_COUNT_OFFSET, op->count);
+    vec_reg_write(VEC_ARG_A_OFFSET, op->arg_a);
+    vec_reg_write(VEC_ARG_B_OFFSET, op->arg_b);
+    vec_reg_write(VEC_DST_OFFSET, op->dst);
+    vec_reg_write(VEC_AP_CTRL_OFFSET, VEC_AP_START);
+
+    /* ap_done은 읽으면 지워지므로 한 번 보면 끝 */
+    while ((vec_reg_read(VEC_AP_CTRL_OFFSET) & VEC_AP_DONE) == 0) {
+        if (bench_now() - t0 > limit) {
+            return 0;
+        }
+    }
+    t = bench_now() - t0;
+    return t == 0 ? 1 : t;
+}
+
+/*******************************************************************************
+ * A53 구현 (포트 A, 워드 단위 Xil_In32 / Xil_Out32)
+ ******************************************************************************/
+static void cpu_add(u32 base, u32 src, u32 count)
+{
+    UINTPTR d = BRAM_BASE_ADDR + (base * 4);
+    UINTPTR s = BRAM_BASE_ADDR + (src * 4);
+    u32 i;
+
+    for (i = 0; i < count; i++) {
+        Xil_Out32(d + (i * 4), Xil_In32(d + (i * 4)) + Xil_In32(s + (i * 4)));
+    }
+}
+
+static void cpu_scale(u32 base, u32 count, s32 mul, u32 shift)
+{
+    UINTPTR d = BRAM_BASE_ADDR + (base * 4);
+    u32 i;
+    s64 p;
+
+    for (i = 0; i < count; i++) {
+        p = (s64)(s32)Xil_In32(d + (i * 4)) * mul;
+        Xil_Out32(d + (i * 4), (u32)(s32)(p >> shift));
+    }
+}
+
+static void cpu_minmax(u32 base, u32 count, u32 dst)
+{
+    UINTPTR s = BRAM_BASE_ADDR + (base * 4);
+    s32 lo = 0x7FFFFFFF, hi = -0x7FFFFFFF - 1;
+    s32 v;
+    u32 i;
+
+    for (i = 0; i < count; i++) {
+        v = (s32)Xil_In32(s + (i * 4));
+        if (v < lo) {
+            lo = v;
+        }
+        if (v > hi) {
+            hi = v;
+        }
+    }
+    Xil_Out32(BRAM_BASE_ADDR + (dst * 4), (u32)lo);
+    Xil_Out32(BRAM_BASE_ADDR + ((dst + 1) * 4), (u32)hi);
+}
+
+static void cpu_hist(u32 base, u32 count, u32 bins, u32 shift, u32 dst)
+{
+    static u32 hist[VEC_HIST_MAX_BINS];
+    UINTPTR s = BRAM_BASE_ADDR + (base * 4);
+    u32 i, b;
+
+    for (b = 0; b < bins; b++) {
+        hist[b] = 0;
+    }
+    for (i = 0; i < count; i++) {
+        b = Xil_In32(s + (i * 4)) >> shift;
+        hist[b < bins ? b : bins - 1]++;
+    }
+    for (b = 0; b < bins; b++) {
+        Xil_Out32(BRAM_BASE_ADDR + ((dst + b) * 4), hist[b]);
+    }
+}
+
+XTime vec_cpu_run(const vec_op_t *op)
+{
+    XTime t0, t;
+
+    if (!vec_op_valid(op)) {
+        return 0;
+    }
+
+    t0 = bench_now();
+    switch (op->op) {
+        case VEC_OP_ADD:
+            cpu_add(op->base, op->arg_a, op->count);
+            break;
+        case VEC_OP_SCALE:
+            cpu_scale(op->base, op->count, (s32)op->arg_a, op->arg_b & 31U);
+            break;
+        case VEC_OP_MINMAX:
+            cpu_minmax(op->base, op->count, op->dst);
+            break;
+        default:
+            cpu_hist(op->base, op->count, op->arg_a, op->arg_b & 31U, op->dst);
+            break;
+    }
+    t = bench_now() - t0;
+    return t == 0 ? 1 : t;
+}
+
+/*******************************************************************************
+ * 메뉴 23
+ ******************************************************************************/
+static void fill_seeded(void)
+{
+    u32 x = VEC_SEED;
+    u32 i;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        Xil_Out32(BRAM_BASE_ADDR + (i * 4), x);
+    }
+}
+
+static u32 count_diff(void)
+{
+    u32 i, errors = 0;
+
+    for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+        if (cpu_img[i] != pl_img[i]) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/* a / b 배율 x 100 */
+static u32 speedup_x100(XTime a, XTime b)
+{
+    return b == 0 ? 0 : (u32)(((u64)a * 100) / b);
+}
+
+/**
+ * @brief 연산별 A53 vs 커널 시간, 결과 BRAM 이미지 일치 확인
+ */
+void test_vec_offload(void)
+{
+    static const vec_op_t ops[VEC_NUM_OPS] = {
+        {VEC_OP_ADD,    0, 1024, 1024,   0,  0},       /* [0,1024) += [1024,2048) */
+        {VEC_OP_SCALE,  0, 2048, 0xC000, 16, 0},       /* x 0.75 (Q16) */
+        {VEC_OP_MINMAX, 0, 2046, 0,      0,  2046},
+        {VEC_OP_HIST,   0, 1792, 64,     26, 1792},    /* 상위 6비트, 64 bins */
+    };
+    static const char *op_names[VEC_NUM_OPS] = {
+        "add 1024", "scale 2048", "min-max 2046", "hist 1792 / 64",
+    };
+    static const char *record_names[VEC_NUM_OPS][2] = {
+        {"add a53",    "add pl"},
+        {"scale a53",  "scale pl"},
+        {"minmax a53", "minmax pl"},
+        {"hist a53",   "hist pl"},
+    };
+    static const vec_op_t empty = {VEC_OP_SCALE, 0, 0, 1, 0, 0};
+    XTime t_cpu, t_pl;
+    u32 i, errors, fails = 0;
+
+    xil_printf("=== PL Vector Kernel Offload ===\r\n");
+
+#if !BRAM_KERNEL_ENABLED
+    xil_printf("Vector kernel is not enabled in this build.\r\n");
+    xil_printf("Export the HLS IP (hls/run_hls.tcl), rebuild the bitstream with\r\n");
+    xil_printf("create_project.tcl -kernel 1 and define BRAM_KERNEL_ENABLED=1 in the Vitis symbols.\r\n");
+    return;
+#endif
+
+    if (!vec_kernel_present()) {
+        xil_printf("Kernel at 0x%08X is not idle (AP_CTRL 0x%08X)\r\n",
+                   BRAM_KERNEL_CTRL_ADDR, vec_reg_read(VEC_AP_CTRL_OFFSET));
+        return;
+    }
+    xil_printf("Registers: 0x%08X, BRAM contents are overwritten\r\n", BRAM_KERNEL_CTRL_ADDR);
+
+    t_pl = vec_kernel_run(&empty);
+    xil_printf("Kernel call overhead (count 0): %d us\r\n", bench_ticks_to_us(t_pl));
+
+    xil_printf("\r\n  Op              A53 us  Kernel us  Speedup  Check\r\n");
+    bench_result_begin("offload");
+    for (i = 0; i < VEC_NUM_OPS; i++) {
+        fill_seeded();
+        t_cpu = vec_cpu_run(&ops[i]);
+        bram_read_multiple(0, cpu_img, BRAM_SIZE_WORDS);
+
+        fill_seeded();
+        t_pl = vec_kernel_run(&ops[i]);
+        bram_read_multiple(0, pl_img, BRAM_SIZE_WORDS);
+
+        errors = (t_pl == 0) ? BRAM_SIZE_WORDS : count_diff();
+        if (errors != 0) {
+            fails++;
+        }
+
+        xil_printf("  %-14s  %6d  %9d  ", op_names[i],
+                   bench_ticks_to_us(t_cpu), bench_ticks_to_us(t_pl));
+        bench_print_x100(speedup_x100(t_cpu, t_pl), 7);
+        if (t_pl == 0) {
+            xil_printf("  timeout\r\n");
+        } else if (errors != 0) {
+            xil_printf("  FAIL (%d words)\r\n", errors);
+        } else {
+            xil_printf("  ok\r\n");
+        }
+
+        bench_result_add(record_names[i][0], 32, 0,
+                         bench_mbps_x100(ops[i].count * 4, t_cpu), BENCH_NONE, NULL);
+        bench_result_add(record_names[i][1], 32, 0,
+                         t_pl == 0 ? BENCH_NONE : bench_mbps_x100(ops[i].count * 4, t_pl),
+                         BENCH_NONE, NULL);
+    }
+    xil_printf("  (Kernel us includes the AXI-Lite start / done round trip;\r\n");
+    xil_printf("   records: wr_mbps = vector bytes processed per second)\r\n");
+
+    xil_printf("\r\nResult: %s (%d failures)\r\n", fails == 0 ? "PASS" : "FAIL", fails);
+    /* 커널 출력은 PL 포트 B로 쓰였으므로 CPU 쪽에서 표시 */
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - PL 벡터 커널 오프로드
+ *
+ * File: bram_offload.h
+ * Description: HLS 커널(hls/bram_vec.cpp)의 AXI-Lite 시작/완료 제어와
+ *              같은 연산의 A53 구현(AXI 포트 A) 비교
+ *              (create_project.tcl -kernel 1 로 빌드한 비트스트림 필요)
+ ******************************************************************************/
+
+#ifndef BRAM_OFFLOAD_H
+#define BRAM_OFFLOAD_H
+
+#include "xil_types.h"
+#include "xtime_l.h"
+#include "bram_test.h"
+
+/*******************************************************************************
+ * 커널 레지스터 (s_axi_control, HLS 생성 xbram_vec_hw.h와 동일)
+ ******************************************************************************/
+#define VEC_AP_CTRL_OFFSET      0x00    /* [0] start [1] done (COR) [2] idle [3] ready */
+#define VEC_OP_OFFSET           0x10
+#define VEC_BASE_OFFSET         0x18
+#define VEC_COUNT_OFFSET        0x20
+#define VEC_ARG_A_OFFSET        0x28
+#define VEC_ARG_B_OFFSET        0x30
+#define VEC_DST_OFFSET          0x38
+
+#define VEC_AP_START            0x1U
+#define VEC_AP_DONE             0x2U
+#define VEC_AP_IDLE             0x4U
+
+/* 연산 코드 (hls/bram_vec.h와 동일) */
+#define VEC_OP_ADD              0       /* mem[base + i] += mem[arg_a + i] */
+#define VEC_OP_SCALE            1       /* mem[base + i] = mem[base + i] * arg_a >> arg_b */
+#define VEC_OP_MINMAX           2       /* mem[dst] = min, mem[dst + 1] = max */
+#define VEC_OP_HIST             3       /* mem[dst ..] = arg_a bins of (x >> arg_b) */
+#define VEC_HIST_MAX_BINS       256
+
+/* 연산 하나 (오프셋/길이는 워드 단위) */
+typedef struct {
+    u32 op;
+    u32 base;
+    u32 count;
+    u32 arg_a;
+    u32 arg_b;
+    u32 dst;
+} vec_op_t;
+
+/* 범위/인자 검사 (커널은 잘못된 연산을 무시하고 끝남) */
+int vec_op_valid(const vec_op_t *op);
+
+/* 커널 유휴 비트 확인 */
+int vec_kernel_present(void);
+
+/**
+ * @brief 커널로 실행 (인자 쓰기 → ap_start → ap_done 폴링)
+ * @return 호출부터 완료 확인까지 경과 틱, 잘못된 연산/타임아웃이면 0
+ */
+XTime vec_kernel_run(const vec_op_t *op);
+
+/* 같은 연산을 A53이 AXI로 실행, 경과 틱 반환 (잘못된 연산이면 0) */
+XTime vec_cpu_run(const vec_op_t *op);
+
+/* 메뉴 23 */
+void test_vec_offload(void);
+
+#endif /* BRAM_OFFLOAD_H */
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 벤치마크 결과 레코드
+ *
+ * File: bram_result.c
+ * Description: 테스트별 결과를 모아 JSON lines로 출력
+ *
+ * 한 줄 = 레코드 하나이며 접두어 "@BENCH " 로 일반 출력과 구분합니다.
+ *   @BENCH {"build":"1a2b3c4","built":"Jan  1 2025 12:00:00","test":"access",
+ *           "case":"Bram<32, Device>","pl_khz":100000,"width":32,"cache":"device",
+ *           "wr_mbps":45.12,"rd_mbps":20.03,"lat_p50_ns":190,...,
+ *           "ps_temp_c":45.12,...,"vccint_min_mv":846,"telem_samples":12}
+ * "stream" 레코드는 wr_mbps/rd_mbps 대신 ingest_mbps, consume_mbps, drop_beats,
+ * drop_frames, stall_pct 를 출력합니다.
+ * xil_printf는 %f를 지원하지 않으므로 MB/s는 x100 고정소수점을 소수 2자리로 출력합니다.
+ *
+ * SYSMON 값은 begin~flush 동안 실행되는 샘플러(bram_telem.c)의 통계이며,
+ * 레코드마다 직전 add(첫 레코드는 begin) 이후 구간입니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "pl_clock.h"
+#include "bram_result.h"
+#include "bram_telem.h"
+
+typedef struct {
+    const char *name;
+    u32 pl_khz;
+    u32 width;
+    int cached;
+    u32 write_mbps_x100;
+    u32 read_mbps_x100;
+    bench_latency_t lat;
+    int has_stream;
+    bench_stream_t stream;
+    telem_stats_t telem;
+} bench_record_t;
+
+static const char *result_test = "";
+static bench_record_t records[BENCH_RESULT_MAX];
+static u32 record_count;
+
+/**
+ * @brief 새 테스트의 레코드 수집 시작
+ */
+void bench_result_begin(const char *test)
+{
+    result_test = test;
+    record_count = 0;
+    telem_start();
+}
+
+/**
+ * @brief 레코드 추가 (PL 클럭은 호출 시점 값, SYSMON은 직전 레코드 이후 구간)
+ * @param lat NULL이면 지연 필드는 null
+ */
+void bench_result_add(const char *name, u32 width, int cached,
+                      u32 write_mbps_x100, u32 read_mbps_x100,
+                      const bench_latency_t *lat)
+{
+    bench_record_t *r;
+
+    if (record_count >= BENCH_RESULT_MAX) {
+        return;
+    }
+    r = &records[record_count++];
+    r->name = name;
+    r->pl_khz = pl_clock_get_khz();
+    r->width = width;
+    r->cached = cached;
+    r->write_mbps_x100 = write_mbps_x100;
+    r->read_mbps_x100 = read_mbps_x100;
+    if (lat != NULL) {
+        r->lat = *lat;
+    } else {
+        r->lat.p50_ns = BENCH_NONE;
+        r->lat.p90_ns = BENCH_NONE;
+        r->lat.p99_ns = BENCH_NONE;
+    }
+    r->has_stream = 0;
+    telem_window(&r->telem);
+}
+
+/**
+ * @brief stream ingest 레코드 추가 (수신/소비율과 손실/stall을 각자의 필드로)
+ */
+void bench_result_add_stream(const char *name, u32 width, const bench_stream_t *s)
+{
+    u32 n = record_count;
+
+    bench_result_add(name, width, 0, BENCH_NONE, BENCH_NONE, NULL);
+    if (record_count != n) {
+        records[n].has_stream = 1;
+        records[n].stream = *s;
+    }
+}
+
+static void print_field_x100(const char *key, u32 value_x100)
+{
+    if (value_x100 == BENCH_NONE) {
+        xil_printf(",\"%s\":null", key);
+    } else {
+        xil_printf(",\"%s\":%d.%02d", key, value_x100 / 100, value_x100 % 100);
+    }
+}
+
+static void print_field_u32(const char *key, u32 value)
+{
+    if (value == BENCH_NONE) {
+        xil_printf(",\"%s\":null", key);
+    } else {
+        xil_printf(",\"%s\":%d", key, value);
+    }
+}
+
+/* 0.01 °C 고정소수점 (음수 가능) */
+static void print_field_c100(const char *key, s32 value_c100)
+{
+    const char *sign = "";
+
+    if (value_c100 < 0) {
+        sign = "-";
+        value_c100 = -value_c100;
+    }
+    xil_printf(",\"%s\":%s%d.%02d", key, sign, value_c100 / 100, value_c100 % 100);
+}
+
+static void print_telem(const telem_stats_t *t)
+{
+    print_field_c100("ps_temp_c", t->ch[TELEM_PS_TEMP].avg);
+    print_field_c100("ps_temp_max_c", t->ch[TELEM_PS_TEMP].max);
+    print_field_c100("pl_temp_c", t->ch[TELEM_PL_TEMP].avg);
+    print_field_c100("pl_temp_max_c", t->ch[TELEM_PL_TEMP].max);
+    print_field_u32("vccint_mv", (u32)t->ch[TELEM_VCCINT].avg);
+    print_field_u32("vccint_min_mv", (u32)t->ch[TELEM_VCCINT].min);
+    print_field_u32("vccbram_mv", (u32)t->ch[TELEM_VCCBRAM].avg);
+    print_field_u32("vccbram_min_mv", (u32)t->ch[TELEM_VCCBRAM].min);
+    print_field_u32("telem_samples", t->samples);
+}
+
+/**
+ * @brief 샘플러를 멈추고 모은 레코드를 JSON lines로 출력하고 비움
+ */
+void bench_result_flush(void)
+{
+    const bench_record_t *r;
+    u32 i;
+
+    telem_stop();
+    if (record_count == 0) {
+        return;
+    }
+    xil_printf("\r\n");
+    for (i = 0; i < record_count; i++) {
+        r = &records[i];
+        xil_printf(BENCH_RESULT_PREFIX "{\"build\":\"%s\",\"built\":\"%s %s\"",
+                   BRAM_BUILD_HASH, __DATE__, __TIME__);
+        xil_printf(",\"test\":\"%s\",\"case\":\"%s\"", result_test, r->name);
+        print_field_u32("pl_khz", r->pl_khz);
+        print_field_u32("width", r->width);
+        xil_printf(",\"cache\":\"%s\"", r->cached ? "wb" : "device");
+        if (r->has_stream) {
+            print_field_x100("ingest_mbps", r->stream.ingest_mbps_x100);
+            print_field_x100("consume_mbps", r->stream.consume_mbps_x100);
+            print_field_u32("drop_beats", r->stream.drop_beats);
+            print_field_u32("drop_frames", r->stream.drop_frames);
+            print_field_x100("stall_pct", r->stream.stall_pct_x100);
+        } else {
+            print_field_x100("wr_mbps", r->write_mbps_x100);
+            print_field_x100("rd_mbps", r->read_mbps_x100);
+        }
+        print_field_u32("lat_p50_ns", r->lat.p50_ns);
+        print_field_u32("lat_p90_ns", r->lat.p90_ns);
+        print_field_u32("lat_p99_ns", r->lat.p99_ns);
+        print_telem(&r->telem);
+        xil_printf("}\r\n");
+    }
+    record_count = 0;
+}
+
+/*******************************************************************************
+ * 지연 측정
+ ******************************************************************************/
+static u32 ticks_to_ns(XTime ticks)
+{
+    return (u32)(((u64)ticks * 1000000000ULL) / COUNTS_PER_SECOND);
+}
+
+/**
+ * @brief BRAM 전체에 흩어진 워드를 하나씩 읽어 지연 백분위수 계산
+ *
+ * 글로벌 타이머 분해능(100 MHz → 10 ns)보다 짧은 값은 0 또는 10 ns로 보입니다.
+ * 타이머 읽기 자체의 비용은 연속 두 번 읽은 최소값으로 빼 줍니다.
+ * 측정 중에는 텔레메트리 샘플러 인터럽트를 막아 ISR(SYSMON 4회 읽기)이
+ * p99/max에 섞이지 않게 합니다.
+ */
+void bench_read_latency(bench_latency_t *lat)
+{
+    static u32 samples[BENCH_LAT_SAMPLES];
+    XTime t0, t1, overhead = ~(XTime)0;
+    u32 i, j, v, off, sum = 0;
+
+    for (i = 0; i < 16; i++) {
+        t0 = bench_now();
+        t1 = bench_now();
+        if (t1 - t0 < overhead) {
+            overhead = t1 - t0;
+        }
+    }
+
+    telem_pause();
+    for (i = 0; i < BENCH_LAT_SAMPLES; i++) {
+        off = (i * 97) % BRAM_SIZE_WORDS;
+        t0 = bench_now();
+        sum += Xil_In32(BRAM_BASE_ADDR + (off * 4));
+        t1 = bench_now();
+        t1 -= t0;
+        samples[i] = ticks_to_ns(t1 > overhead ? t1 - overhead : 0);
+    }
+    telem_resume();
+    (void)sum;
+
+    /* 삽입 정렬 (256개) */
+    for (i = 1; i < BENCH_LAT_SAMPLES; i++) {
+        v = samples[i];
+        for (j = i; j > 0 && samples[j - 1] > v; j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = v;
+    }
+
+    lat->p50_ns = samples[(BENCH_LAT_SAMPLES * 50) / 100];
+    lat->p90_ns = samples[(BENCH_LAT_SAMPLES * 90) / 100];
+    lat->p99_ns = samples[(BENCH_LAT_SAMPLES * 99) / 100];
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 벤치마크 결과 레코드
+ *
+ * File: bram_result.h
+ * Description: 벤치마크 결과를 JSON lines 레코드("@BENCH {...}")로 UART에 출력
+ *              (tools/bench_history.tcl 이 캡처 로그에서 수집 / 회귀 검출)
+ ******************************************************************************/
+
+#ifndef BRAM_RESULT_H
+#define BRAM_RESULT_H
+
+#include "xil_types.h"
+
+/* 빌드 식별자 (Vitis Symbols에 BRAM_BUILD_HASH=\"<git 해시>\" 추가) */
+#ifndef BRAM_BUILD_HASH
+#define BRAM_BUILD_HASH     "unknown"
+#endif
+
+#define BENCH_RESULT_PREFIX "@BENCH "
+#define BENCH_RESULT_MAX    32          /* 테스트 하나가 모을 수 있는 레코드 수 */
+#define BENCH_NONE          0xFFFFFFFFU /* 측정하지 않은 값 → null */
+#define BENCH_LAT_SAMPLES   256
+
+/* 읽기 지연 백분위수 (ns) */
+typedef struct {
+    u32 p50_ns;
+    u32 p90_ns;
+    u32 p99_ns;
+} bench_latency_t;
+
+/* "stream" 레코드 전용 필드 (wr_mbps/rd_mbps 대신 출력) */
+typedef struct {
+    u32 ingest_mbps_x100;   /* PL이 BRAM에 쓴 속도 */
+    u32 consume_mbps_x100;  /* CPU가 검증/반납한 속도 */
+    u32 drop_beats;
+    u32 drop_frames;
+    u32 stall_pct_x100;     /* backpressure로 발생기가 멈춘 사이클 비율 */
+} bench_stream_t;
+
+/* 레코드 수집: begin → add ... → flush (테스트 표 출력 뒤 한 번에 출력) */
+void bench_result_begin(const char *test);
+void bench_result_add(const char *name, u32 width, int cached,
+                      u32 write_mbps_x100, u32 read_mbps_x100,
+                      const bench_latency_t *lat);
+void bench_result_add_stream(const char *name, u32 width, const bench_stream_t *s);
+void bench_result_flush(void);
+
+/* 단일 32비트 읽기 지연 측정 (BENCH_LAT_SAMPLES회) */
+void bench_read_latency(bench_latency_t *lat);
+
+#endif /* BRAM_RESULT_H */
@@ -0,0 +1,310 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Snapshot / Diff
+ *
+ * File: bram_snap.c
+ * Description: DDR 섀도 + 256바이트 블록 체크섬(FNV-1a)으로 변경 범위만 출력 (메뉴 20)
+ *
+ * UART(115200 bps) 출력이 덤프 시간의 대부분이므로, 전체 덤프(2048줄) 대신
+ * 바뀐 범위만 출력하면 비용이 변경량에 비례합니다. dirty 모드는 BRAM 읽기도
+ * 표시된 블록으로 줄이고, 체크섬 모드는 모든 블록을 읽되 워드 비교/출력은
+ * 체크섬이 달라진 블록만 합니다 (32비트 체크섬 충돌 시 변경을 놓칠 수 있음).
+ *
+ * 출력 예:
+ *   [  64..  79]   16 words
+ *       64  0x00000000 -> 0x12345678
+ *       ...
+ *       ...    8 more
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_snap.h"
+
+#define SNAP_FNV_OFFSET     0x811C9DC5U
+#define SNAP_FNV_PRIME      0x01000193U
+
+/* 고정 폭 출력 줄 길이 (\r\n 포함) - 출력하지 않을 때 UART 비용 추정용 */
+#define SNAP_HDR_CHARS      27      /* "  [%4d..%4d] %4d words" */
+#define SNAP_VAL_CHARS      36      /* "    %4d  0x%08X -> 0x%08X" */
+#define SNAP_MORE_CHARS     19      /* "    ... %4d more" */
+#define SNAP_DUMP_CHARS     42      /* hex_dump 한 줄 */
+#define SNAP_UART_BAUD      115200
+
+u32 snap_dirty[(SNAP_BLOCKS + 31) / 32];
+
+static u32 snap_shadow[BRAM_SIZE_WORDS];
+static u32 snap_sum[SNAP_BLOCKS];
+static int snap_taken;
+
+/* 열린 변경 범위 (앞 SNAP_SHOW_MAX 워드의 이전/현재 값 보관) */
+typedef struct {
+    u32 start;
+    u32 count;
+    u32 old_v[SNAP_SHOW_MAX];
+    u32 new_v[SNAP_SHOW_MAX];
+} snap_range_t;
+
+static u32 block_sum(const u32 *w)
+{
+    u32 i, h = SNAP_FNV_OFFSET;
+
+    for (i = 0; i < SNAP_BLOCK_WORDS; i++) {
+        h = (h ^ w[i]) * SNAP_FNV_PRIME;
+    }
+    return h;
+}
+
+int snap_valid(void)
+{
+    return snap_taken;
+}
+
+void snap_take(void)
+{
+    u32 b, i;
+
+    bram_read_multiple(0, snap_shadow, BRAM_SIZE_WORDS);
+    for (b = 0; b < SNAP_BLOCKS; b++) {
+        snap_sum[b] = block_sum(&snap_shadow[b * SNAP_BLOCK_WORDS]);
+    }
+    for (i = 0; i < sizeof(snap_dirty) / sizeof(snap_dirty[0]); i++) {
+        snap_dirty[i] = 0;
+    }
+    snap_taken = 1;
+}
+
+/*******************************************************************************
+ * 범위 출력
+ ******************************************************************************/
+static void range_close(snap_range_t *r, snap_diff_t *st, u32 flags)
+{
+    u32 i, shown;
+
+    if (r->count == 0) {
+        return;
+    }
+    shown = r->count < SNAP_SHOW_MAX ? r->count : SNAP_SHOW_MAX;
+    st->ranges++;
+    st->out_chars += SNAP_HDR_CHARS + shown * SNAP_VAL_CHARS +
+                     (r->count > shown ? SNAP_MORE_CHARS : 0);
+
+    if (flags & SNAP_PRINT) {
+        xil_printf("  [%4d..%4d] %4d words\r\n", r->start, r->start + r->count - 1, r->count);
+        for (i = 0; i < shown; i++) {
+            xil_printf("    %4d  0x%08X -> 0x%08X\r\n", r->start + i, r->old_v[i], r->new_v[i]);
+        }
+        if (r->count > shown) {
+            xil_printf("    ... %4d more\r\n", r->count - shown);
+        }
+    }
+    r->count = 0;
+}
+
+static void range_add(snap_range_t *r, snap_diff_t *st, u32 flags,
+                      u32 offset, u32 old_v, u32 new_v)
+{
+    if (r->count != 0 && r->start + r->count != offset) {
+        range_close(r, st, flags);
+    }
+    if (r->count == 0) {
+        r->start = offset;
+    }
+    if (r->count < SNAP_SHOW_MAX) {
+        r->old_v[r->count] = old_v;
+        r->new_v[r->count] = new_v;
+    }
+    r->count++;
+    st->words_changed++;
+}
+
+/*******************************************************************************
+ * diff
+ ******************************************************************************/
+u32 snap_diff(u32 mode, u32 flags, snap_diff_t *st)
+{
+    static u32 buf[SNAP_BLOCK_WORDS];
+    snap_diff_t local;
+    snap_range_t range;
+    u32 b, i, base, sum, bit;
+
+    if (st == NULL) {
+        st = &local;
+    }
+    st->blocks_read = 0;
+    st->blocks_changed = 0;
+    st->words_changed = 0;
+    st->ranges = 0;
+    st->out_chars = 0;
+    range.count = 0;
+
+    if (!snap_taken) {
+        return 0;
+    }
+
+    for (b = 0; b < SNAP_BLOCKS; b++) {
+        bit = 1U << (b & 31);
+        if (mode == SNAP_SCAN_DIRTY && !(snap_dirty[b >> 5] & bit)) {
+            continue;
+        }
+
+        base = b * SNAP_BLOCK_WORDS;
+        bram_read_multiple(base, buf, SNAP_BLOCK_WORDS);
+        st->blocks_read++;
+
+        sum = block_sum(buf);
+        if (sum != snap_sum[b]) {
+            st->blocks_changed++;
+            for (i = 0; i < SNAP_BLOCK_WORDS; i++) {
+                if (buf[i] != snap_shadow[base + i]) {
+                    range_add(&range, st, flags, base + i, snap_shadow[base + i], buf[i]);
+                }
+            }
+        }
+
+        if (flags & SNAP_UPDATE) {
+            if (sum != snap_sum[b]) {
+                for (i = 0; i < SNAP_BLOCK_WORDS; i++) {
+                    snap_shadow[base + i] = buf[i];
+                }
+                snap_sum[b] = sum;
+            }
+            snap_dirty[b >> 5] &= ~bit;
+        }
+    }
+    range_close(&range, st, flags);
+
+    return st->words_changed;
+}
+
+/*******************************************************************************
+ * 벤치마크
+ ******************************************************************************/
+static u32 uart_ms(u32 chars)
+{
+    /* 8N1 = 문자당 10비트 */
+    return (u32)(((u64)chars * 10 * 1000) / SNAP_UART_BAUD);
+}
+
+/**
+ * @brief 변경 워드 수별로 전체 읽기(덤프) / dirty diff / 체크섬 diff 비용 비교
+ *
+ * 출력 없이 측정하고, UART 시간은 줄 길이로 추정합니다. BRAM 내용은 덮어씁니다.
+ */
+static void bench_snapshot(void)
+{
+    static const u32 changes[] = {0, 1, 16, 256, BRAM_SIZE_WORDS};
+    snap_diff_t sd, sc;
+    XTime t0, t_full, t_dirty, t_sum;
+    u32 c, i, k, step, sum = 0;
+
+    xil_printf("\r\n  Changed  Full read  Dirty diff        Checksum diff     UART dump  UART diff\r\n");
+    xil_printf("  words    us         us (blocks)       us (blocks)       ms         ms\r\n");
+
+    for (c = 0; c < sizeof(changes) / sizeof(changes[0]); c++) {
+        k = changes[c];
+
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            bram_write_single(i, i * 0x9E3779B1U);
+        }
+        snap_take();
+        step = (k == 0) ? BRAM_SIZE_WORDS : BRAM_SIZE_WORDS / k;
+        for (i = 0; i < k; i++) {
+            bram_write_single(i * step, ~(i * step * 0x9E3779B1U));
+            snap_mark_dirty(i * step, 1);
+        }
+
+        /* 덤프/전체 읽기와 같은 BRAM 쪽 비용 */
+        t0 = bench_now();
+        for (i = 0; i < BRAM_SIZE_WORDS; i++) {
+            sum += bram_read_single(i);
+        }
+        t_full = bench_now() - t0;
+
+        t0 = bench_now();
+        snap_diff(SNAP_SCAN_DIRTY, 0, &sd);
+        t_dirty = bench_now() - t0;
+
+        t0 = bench_now();
+        snap_diff(SNAP_SCAN_CHECKSUM, 0, &sc);
+        t_sum = bench_now() - t0;
+
+        xil_printf("  %4d     %6d     %6d (%2d)       %6d (%2d)       %6d     %6d",
+                   k, bench_ticks_to_us(t_full),
+                   bench_ticks_to_us(t_dirty), sd.blocks_read,
+                   bench_ticks_to_us(t_sum), sc.blocks_read,
+                   uart_ms(BRAM_SIZE_WORDS * SNAP_DUMP_CHARS), uart_ms(sd.out_chars));
+        if (sd.words_changed != k || sc.words_changed != k) {
+            xil_printf("  MISMATCH (%d / %d)", sd.words_changed, sc.words_changed);
+        }
+        xil_printf("\r\n");
+    }
+    (void)sum;
+    snap_take();
+}
+
+/*******************************************************************************
+ * 메뉴 20
+ ******************************************************************************/
+static void run_diff(u32 mode)
+{
+    snap_diff_t st;
+    XTime t0, t;
+
+    if (!snap_taken) {
+        xil_printf("No snapshot - take one first.\r\n");
+        return;
+    }
+    xil_printf("Changes since snapshot (%s):\r\n",
+               mode == SNAP_SCAN_DIRTY ? "dirty blocks" : "checksum scan");
+    t0 = bench_now();
+    snap_diff(mode, SNAP_PRINT | SNAP_UPDATE, &st);
+    t = bench_now() - t0;
+    xil_printf("%d words in %d ranges, read %d/%d blocks (%d changed), %d us\r\n",
+               st.words_changed, st.ranges, st.blocks_read, SNAP_BLOCKS,
+               st.blocks_changed, bench_ticks_to_us(t));
+    xil_printf("Snapshot updated.\r\n");
+}
+
+/**
+ * @brief 스냅샷 / diff / 벤치마크 선택
+ */
+void test_snapshot(void)
+{
+    u32 b, dirty = 0;
+
+    xil_printf("=== Snapshot / Diff ===\r\n");
+    if (snap_taken) {
+        for (b = 0; b < SNAP_BLOCKS; b++) {
+            dirty += (snap_dirty[b >> 5] >> (b & 31)) & 1U;
+        }
+        xil_printf("Snapshot: taken, %d/%d blocks dirty (%d bytes per block)\r\n",
+                   dirty, SNAP_BLOCKS, SNAP_BLOCK_WORDS * 4);
+    } else {
+        xil_printf("Snapshot: none\r\n");
+    }
+    xil_printf("  1. Take snapshot\r\n");
+    xil_printf("  2. Diff (dirty blocks, writes through bram_write_*)\r\n");
+    xil_printf("  3. Diff (full scan, block checksums)\r\n");
+    xil_printf("  4. Benchmark: full dump vs diff\r\n");
+
+    switch (get_dec_input("Select: ")) {
+        case 1:
+            snap_take();
+            xil_printf("Snapshot taken (%d words).\r\n", BRAM_SIZE_WORDS);
+            break;
+        case 2:
+            run_diff(SNAP_SCAN_DIRTY);
+            break;
+        case 3:
+            run_diff(SNAP_SCAN_CHECKSUM);
+            break;
+        case 4:
+            bench_snapshot();
+            break;
+        default:
+            xil_printf("Invalid choice!\r\n");
+            break;
+    }
+}
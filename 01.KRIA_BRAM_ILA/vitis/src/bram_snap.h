@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - Snapshot / Diff
+ *
+ * File: bram_snap.h
+ * Description: DDR 섀도 복사본과 블록 체크섬으로 BRAM 변경 영역만 찾아
+ *              출력하는 스냅샷/diff (덤프 비용을 변경량에 비례하게)
+ *
+ * 변경 블록 찾기:
+ *   SNAP_SCAN_DIRTY    - 메뉴/테스트가 snap_mark_dirty()로 표시한 블록만 읽음
+ *                        쓰기 메뉴는 쓴 범위를, BRAM을 덮어쓰는 테스트는 끝날 때
+ *                        전체를 표시. 벤치마크가 재는 BRAM_HOT 액세서는 표시하지 않음
+ *                        메뉴 밖의 Xil_Out 직접 쓰기, PL 포트 B 쓰기, JTAG 쓰기는
+ *                        보이지 않으므로 그때는 체크섬 모드를 사용
+ *   SNAP_SCAN_CHECKSUM - 모든 블록을 읽고 체크섬이 다른 블록만 워드 비교
+ ******************************************************************************/
+
+#ifndef BRAM_SNAP_H
+#define BRAM_SNAP_H
+
+#include "xil_types.h"
+#include "bram_test.h"
+
+#define SNAP_BLOCK_SHIFT    6
+#define SNAP_BLOCK_WORDS    (1U << SNAP_BLOCK_SHIFT)            /* 256 바이트 */
+#define SNAP_BLOCKS         (BRAM_SIZE_WORDS / SNAP_BLOCK_WORDS)
+#define SNAP_SHOW_MAX       8       /* 범위당 출력할 워드 수 */
+
+#define SNAP_SCAN_DIRTY     0
+#define SNAP_SCAN_CHECKSUM  1
+
+/* snap_diff 플래그 */
+#define SNAP_PRINT          (1U << 0)   /* 변경 범위 출력 */
+#define SNAP_UPDATE         (1U << 1)   /* 비교 후 섀도/체크섬 갱신 (다음 diff는 이후 변경만) */
+
+typedef struct {
+    u32 blocks_read;        /* BRAM에서 읽은 블록 */
+    u32 blocks_changed;     /* 체크섬이 달라진 블록 */
+    u32 words_changed;
+    u32 ranges;
+    u32 out_chars;          /* 출력했거나(SNAP_PRINT) 출력했을 문자 수 */
+} snap_diff_t;
+
+/* 블록별 dirty 비트 (메뉴/테스트 계층에서 갱신) */
+extern u32 snap_dirty[(SNAP_BLOCKS + 31) / 32];
+
+/**
+ * @brief 쓰기 범위를 dirty로 표시 (워드 오프셋, BRAM 범위 밖은 무시)
+ */
+static inline void snap_mark_dirty(u32 offset, u32 count)
+{
+    u32 b, last;
+
+    if (count == 0) {
+        return;
+    }
+    last = (offset + count - 1) >> SNAP_BLOCK_SHIFT;
+    for (b = offset >> SNAP_BLOCK_SHIFT; b <= last && b < SNAP_BLOCKS; b++) {
+        snap_dirty[b >> 5] |= 1U << (b & 31);
+    }
+}
+
+/* BRAM 전체를 섀도에 복사하고 체크섬 계산, dirty 비트 클리어 */
+void snap_take(void);
+
+/**
+ * @brief 스냅샷 이후 변경된 워드 범위 찾기
+ * @param mode SNAP_SCAN_DIRTY / SNAP_SCAN_CHECKSUM
+ * @param flags SNAP_PRINT | SNAP_UPDATE
+ * @param st 통계 (NULL 가능)
+ * @return 변경된 워드 수 (스냅샷이 없으면 0)
+ */
+u32 snap_diff(u32 mode, u32 flags, snap_diff_t *st);
+
+/* 스냅샷이 있는지 */
+int snap_valid(void);
+
+/* 메뉴 20 */
+void test_snapshot(void);
+
+#endif /* BRAM_SNAP_H */
@@ -0,0 +1,255 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - AXI-Stream Ingest
+ *
+ * File: bram_stream.c
+ * Description: PL 패턴 발생기 → 프레임 링 writer → BRAM 포트 B 경로를 켜고,
+ *              CPU가 포트 A(AXI)로 프레임을 검증/반납하면서 지속 수신률,
+ *              버린 beat / 프레임, stall을 측정 (메뉴 22)
+ *
+ * 프레임 내용은 {프레임 번호[31:16], beat 번호[15:0]} 입니다. 링은 BRAM 전체를
+ * 슬롯으로 쓰므로 실행 후 BRAM 내용은 덮어써집니다.
+ * 수신률은 PL 카운터(BEATS / CYCLES)로 계산하므로 CPU 측 타이머 오차가 없고,
+ * 소비율은 CPU가 실제로 읽고 반납한 프레임 기준입니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+#include "pl_clock.h"
+#include "bram_stream.h"
+
+#define STREAM_RUN_MS           200
+#define STREAM_FRAME_WORDS      256     /* 1KB 프레임 */
+#define STREAM_SLOTS            (BRAM_SIZE_WORDS / STREAM_FRAME_WORDS)
+#define STREAM_NUM_RATES        3
+
+/* 소비자 상태 (stream_start에서 초기화) */
+static stream_config_t cur;
+static u32 rd_slot;
+static u32 next_frame;
+static u32 consumed;
+static u32 bad_frames;
+static XTime run_start;
+
+/*******************************************************************************
+ * 레지스터 접근
+ ******************************************************************************/
+u32 stream_reg_read(u32 offset)
+{
+    return Xil_In32(BRAM_STREAM_CTRL_ADDR + offset);
+}
+
+void stream_reg_write(u32 offset, u32 value)
+{
+    Xil_Out32(BRAM_STREAM_CTRL_ADDR + offset, value);
+}
+
+int stream_present(void)
+{
+    return stream_reg_read(STREAM_ID_OFFSET) == STREAM_ID;
+}
+
+/*******************************************************************************
+ * 실행
+ ******************************************************************************/
+int stream_start(const stream_config_t *cfg)
+{
+    if (cfg->frame_words == 0 || cfg->slots == 0 || cfg->frame_words > 0xFFFF ||
+        cfg->rate_div > 0xFFFF || cfg->frame_words * cfg->slots > BRAM_SIZE_WORDS) {
+        return 0;
+    }
+
+    /* enable = 0 으로 링 리셋 + 카운터 클리어 후 설정 */
+    stream_reg_write(STREAM_CTRL_OFFSET, STREAM_CTRL_CLEAR);
+    stream_reg_write(STREAM_FRAME_WORDS_OFFSET, cfg->frame_words);
+    stream_reg_write(STREAM_SLOTS_OFFSET, cfg->slots);
+    stream_reg_write(STREAM_RATE_DIV_OFFSET, cfg->rate_div);
+
+    cur = *cfg;
+    rd_slot = 0;
+    next_frame = 0;
+    consumed = 0;
+    bad_frames = 0;
+
+    run_start = bench_now();
+    stream_reg_write(STREAM_CTRL_OFFSET,
+                     STREAM_CTRL_ENABLE | (cfg->drop_on_full ? STREAM_CTRL_DROP : 0));
+    return 1;
+}
+
+/**
+ * @brief 프레임 하나 검증: 모든 워드가 같은 프레임 번호 + 순서대로인 beat 번호
+ *
+ * drop 모드에서는 버린 프레임만큼 번호가 건너뛰므로 앞으로만 가면 정상이고,
+ * stall 모드에서는 빠짐없이 연속이어야 합니다.
+ */
+static int check_frame(u32 slot)
+{
+    UINTPTR base = BRAM_BASE_ADDR + (slot * cur.frame_words * 4);
+    u32 first = Xil_In32(base);
+    u32 frame = first >> 16;
+    u32 i;
+    int ok;
+
+    if (cur.drop_on_full) {
+        ok = (consumed == 0) || (((frame - next_frame) & 0xFFFF) < 0x8000);
+    } else {
+        ok = (frame == next_frame);
+    }
+    for (i = 0; i < cur.frame_words; i++) {
+        if (Xil_In32(base + (i * 4)) != ((first & 0xFFFF0000U) | i)) {
+            ok = 0;
+        }
+    }
+    next_frame = (frame + 1) & 0xFFFF;
+    return ok;
+}
+
+u32 stream_consume(void)
+{
+    u32 pending = stream_reg_read(STREAM_PENDING_OFFSET);
+    u32 n;
+
+    for (n = 0; n < pending; n++) {
+        if (!check_frame(rd_slot)) {
+            bad_frames++;
+        }
+        rd_slot = (rd_slot + 1 == cur.slots) ? 0 : rd_slot + 1;
+    }
+    if (pending != 0) {
+        stream_reg_write(STREAM_RELEASE_OFFSET, pending);
+        consumed += pending;
+    }
+    return pending;
+}
+
+void stream_stop(stream_stats_t *st)
+{
+    XTime t = bench_now() - run_start;
+    u32 khz = pl_clock_get_khz();
+
+    stream_reg_write(STREAM_CTRL_OFFSET, 0);
+
+    st->cycles = stream_reg_read(STREAM_CYCLES_OFFSET);
+    st->beats = stream_reg_read(STREAM_BEATS_OFFSET);
+    st->frames = stream_reg_read(STREAM_FRAMES_OFFSET);
+    st->drop_beats = stream_reg_read(STREAM_DROP_BEATS_OFFSET);
+    st->drop_frames = stream_reg_read(STREAM_DROP_FRAMES_OFFSET);
+    st->stall_cycles = stream_reg_read(STREAM_STALL_OFFSET);
+    st->fill_max = stream_reg_read(STREAM_FILL_MAX_OFFSET);
+    st->consumed = consumed;
+    st->bad_frames = bad_frames;
+
+    /* beats x 4B / (cycles / kHz) ms → MB/s x 100 */
+    st->ingest_mbps_x100 = (st->cycles == 0) ? 0 :
+        (u32)(((u64)st->beats * 4 * khz) / ((u64)st->cycles * 10));
+    st->consume_mbps_x100 = bench_mbps_x100(consumed * cur.frame_words * 4, t);
+}
+
+int stream_run(const stream_config_t *cfg, u32 run_ms, stream_stats_t *st)
+{
+    XTime end;
+
+    if (!stream_start(cfg)) {
+        return 0;
+    }
+    end = run_start + ((XTime)run_ms * COUNTS_PER_SECOND) / 1000;
+    while (bench_now() < end) {
+        stream_consume();
+    }
+    stream_stop(st);
+    return 1;
+}
+
+/*******************************************************************************
+ * 메뉴 22
+ ******************************************************************************/
+/* x / total 을 % x 100 으로 */
+static u32 pct_x100(u32 x, u32 total)
+{
+    return total == 0 ? 0 : (u32)(((u64)x * 10000) / total);
+}
+
+/**
+ * @brief 발생기 속도 x backpressure 모드별 수신률 / 손실 / stall 보고
+ */
+void test_stream_ingest(void)
+{
+    static const u32 rates[STREAM_NUM_RATES] = {0, 3, 15};
+    static const char *record_names[2][STREAM_NUM_RATES] = {
+        {"stall div 1", "stall div 4", "stall div 16"},
+        {"drop div 1",  "drop div 4",  "drop div 16"},
+    };
+    stream_config_t cfg;
+    stream_stats_t st;
+    bench_stream_t rec;
+    u32 mode, r, khz, fails = 0;
+    int ok;
+
+    xil_printf("=== AXI-Stream Ingest ===\r\n");
+
+#if !BRAM_STREAM_ENABLED
+    xil_printf("Stream ingest is not enabled in this build.\r\n");
+    xil_printf("Rebuild the bitstream with create_project.tcl -stream 1 and\r\n");
+    xil_printf("define BRAM_STREAM_ENABLED=1 in the Vitis symbols.\r\n");
+    return;
+#endif
+
+    if (!stream_present()) {
+        xil_printf("No stream_ingest ID at 0x%08X (read 0x%08X)\r\n",
+                   BRAM_STREAM_CTRL_ADDR, stream_reg_read(STREAM_ID_OFFSET));
+        return;
+    }
+
+    khz = pl_clock_get_khz();
+    xil_printf("Registers: 0x%08X, PL clock %d kHz\r\n", BRAM_STREAM_CTRL_ADDR, khz);
+    xil_printf("Ring: %d slots x %d words (whole BRAM, contents overwritten)\r\n",
+               STREAM_SLOTS, STREAM_FRAME_WORDS);
+    xil_printf("Consumer: CPU verifies each frame over AXI and releases it, %d ms per run\r\n",
+               STREAM_RUN_MS);
+
+    cfg.frame_words = STREAM_FRAME_WORDS;
+    cfg.slots = STREAM_SLOTS;
+
+    xil_printf("\r\n  Mode   Offered MB/s  Ingest MB/s  Consume MB/s  Dropped beats  Dropped frames  Stall %%  Fill  Check\r\n");
+    bench_result_begin("stream");
+    for (mode = 0; mode < 2; mode++) {
+        for (r = 0; r < STREAM_NUM_RATES; r++) {
+            cfg.rate_div = rates[r];
+            cfg.drop_on_full = (int)mode;
+            stream_run(&cfg, STREAM_RUN_MS, &st);
+
+            xil_printf("  %-5s  ", mode ? "drop" : "stall");
+            bench_print_x100((u32)(((u64)4 * khz) / (10 * (rates[r] + 1))), 12);
+            xil_printf("  ");
+            bench_print_x100(st.ingest_mbps_x100, 11);
+            xil_printf("  ");
+            bench_print_x100(st.consume_mbps_x100, 12);
+            xil_printf("  %13d  %14d  ", st.drop_beats, st.drop_frames);
+            bench_print_x100(pct_x100(st.stall_cycles, st.cycles), 7);
+            /* 모드별 불변식: stall은 잃지 않고, drop은 발생기를 멈추지 않음 */
+            ok = st.bad_frames == 0 && st.consumed != 0 &&
+                 (mode ? st.stall_cycles == 0 : st.drop_beats == 0 && st.drop_frames == 0);
+            xil_printf("  %2d/%d  %s\r\n", st.fill_max, STREAM_SLOTS, ok ? "ok" : "FAIL");
+            if (!ok) {
+                fails++;
+            }
+            rec.ingest_mbps_x100 = st.ingest_mbps_x100;
+            rec.consume_mbps_x100 = st.consume_mbps_x100;
+            rec.drop_beats = st.drop_beats;
+            rec.drop_frames = st.drop_frames;
+            rec.stall_pct_x100 = pct_x100(st.stall_cycles, st.cycles);
+            bench_result_add_stream(record_names[mode][r], 32, &rec);
+        }
+    }
+    xil_printf("  (Offered = generator rate, Ingest = beats written to BRAM / PL time,\r\n");
+    xil_printf("   Consume = frames the CPU verified and released / run time)\r\n");
+
+    xil_printf("\r\nResult: %s (%d failures)\r\n", fails == 0 ? "PASS" : "FAIL", fails);
+    /* PL 포트 B로 쓴 프레임은 CPU 쓰기 경로를 거치지 않음 */
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
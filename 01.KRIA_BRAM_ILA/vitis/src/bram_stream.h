@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - AXI-Stream Ingest
+ *
+ * File: bram_stream.h
+ * Description: PL 스트림 writer(vivado/src/stream_ingest.v)가 BRAM 포트 B에
+ *              쓰는 프레임 링 제어, CPU 소비자, 처리량/backpressure 카운터
+ *              (create_project.tcl -stream 1 로 빌드한 비트스트림 필요)
+ ******************************************************************************/
+
+#ifndef BRAM_STREAM_H
+#define BRAM_STREAM_H
+
+#include "xil_types.h"
+#include "bram_test.h"
+
+/*******************************************************************************
+ * 레지스터 (BRAM_STREAM_CTRL_ADDR 오프셋)
+ ******************************************************************************/
+#define STREAM_CTRL_OFFSET          0x00    /* [0] enable [1] drop_on_full [31] clear */
+#define STREAM_STATUS_OFFSET        0x04
+#define STREAM_FRAME_WORDS_OFFSET   0x08
+#define STREAM_SLOTS_OFFSET         0x0C
+#define STREAM_RATE_DIV_OFFSET      0x10
+#define STREAM_WR_SLOT_OFFSET       0x14
+#define STREAM_RELEASE_OFFSET       0x18
+#define STREAM_PENDING_OFFSET       0x1C
+#define STREAM_CYCLES_OFFSET        0x20
+#define STREAM_BEATS_OFFSET         0x24
+#define STREAM_FRAMES_OFFSET        0x28
+#define STREAM_DROP_BEATS_OFFSET    0x2C
+#define STREAM_DROP_FRAMES_OFFSET   0x30
+#define STREAM_STALL_OFFSET         0x34
+#define STREAM_FILL_MAX_OFFSET      0x38
+#define STREAM_ID_OFFSET            0x3C
+
+#define STREAM_CTRL_ENABLE          0x1U
+#define STREAM_CTRL_DROP            0x2U
+#define STREAM_CTRL_CLEAR           0x80000000U
+#define STREAM_ID                   0x5354524DU     /* "STRM" */
+
+/* 링 / 발생기 설정 (frame_words x slots <= BRAM_SIZE_WORDS) */
+typedef struct {
+    u32 frame_words;        /* 프레임 길이 = 슬롯 크기 (워드) */
+    u32 slots;
+    u32 rate_div;           /* 발생기 beat 간격 - 1 (0 = 매 PL 사이클) */
+    int drop_on_full;       /* 0 = 슬롯이 없으면 stall, 1 = 프레임 버림 */
+} stream_config_t;
+
+/* 실행 결과 (PL 카운터 + CPU 소비자) */
+typedef struct {
+    u32 cycles;             /* enable 동안의 PL 사이클 */
+    u32 beats;              /* BRAM에 쓴 beat */
+    u32 frames;
+    u32 drop_beats;
+    u32 drop_frames;
+    u32 stall_cycles;
+    u32 fill_max;           /* 최대 미반납 프레임 수 */
+    u32 consumed;           /* CPU가 읽고 반납한 프레임 */
+    u32 bad_frames;         /* 패턴/순서가 틀린 프레임 */
+    u32 ingest_mbps_x100;   /* BEATS x 4B / (CYCLES / PL 클럭) */
+    u32 consume_mbps_x100;  /* 소비한 바이트 / 실행 시간 */
+} stream_stats_t;
+
+u32 stream_reg_read(u32 offset);
+void stream_reg_write(u32 offset, u32 value);
+
+/* ID 레지스터 확인 */
+int stream_present(void);
+
+/**
+ * @brief 카운터 클리어 후 설정을 쓰고 스트림 시작
+ * @return 1 = 시작, 0 = 설정 불가 (슬롯이 BRAM을 넘음 등)
+ */
+int stream_start(const stream_config_t *cfg);
+
+/* 완료된 프레임을 모두 검증하고 반납, 반납한 프레임 수 반환 */
+u32 stream_consume(void);
+
+/* 스트림 정지 후 카운터와 소비자 통계 수집 */
+void stream_stop(stream_stats_t *st);
+
+/* start → run_ms 동안 consume → stop */
+int stream_run(const stream_config_t *cfg, u32 run_ms, stream_stats_t *st);
+
+/* 메뉴 22 */
+void test_stream_ingest(void);
+
+#endif /* BRAM_STREAM_H */
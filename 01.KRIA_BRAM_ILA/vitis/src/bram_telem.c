@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - SYSMON 텔레메트리
+ *
+ * File: bram_telem.c
+ * Description: TTC0 interval 인터럽트(기본 1 kHz)에서 PS/PL SYSMON 레지스터
+ *              4개를 읽어 구간별 합/최소/최대를 누적 (메뉴 21)
+ *
+ * ISR은 APB 레지스터 읽기 4회와 누적만 하고 변환은 telem_window에서 합니다.
+ * ADC 코드 → 물리값 (XSysMonPsu_RawToTemperature_OnChip / RawToVoltage):
+ *   온도 °C = code * 509.3140064 / 65536 - 280.2308787
+ *   전압 V  = code * 3.0 / 65536
+ * 두 변환 모두 단조 증가이므로 최소/최대는 코드로 비교합니다.
+ *
+ * xparameters.h에 TTC가 없으면 타이머 없이 telem_window 호출 시점에만 샘플합니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "xparameters.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "bram_snap.h"
+#include "bram_telem.h"
+
+#ifdef XPAR_XTTCPS_0_DEVICE_ID
+#define TELEM_HAS_TIMER     1
+#include "xscugic.h"
+#include "xttcps.h"
+#include "xil_exception.h"
+#else
+#define TELEM_HAS_TIMER     0
+#endif
+
+#ifndef TELEM_TTC_DEVICE_ID
+#define TELEM_TTC_DEVICE_ID XPAR_XTTCPS_0_DEVICE_ID
+#define TELEM_TTC_INTR      XPAR_XTTCPS_0_INTR
+#endif
+
+#define TELEM_IRQ_PRIORITY  0xA0
+#define TELEM_BENCH_ROUNDS  256
+#define SYSMON_CODE_MASK    0xFFFFU
+
+/* 구간 누적 (ISR과 공유, 읽을 때는 IRQ 마스크) */
+static volatile struct {
+    u32 samples;
+    u64 sum[TELEM_CHANNELS];
+    u32 min[TELEM_CHANNELS];
+    u32 max[TELEM_CHANNELS];
+} acc;
+
+static const UINTPTR channel_reg[TELEM_CHANNELS] = {
+    SYSMON_PS_BASEADDR + SYSMON_TEMP_OFFSET,
+    SYSMON_PL_BASEADDR + SYSMON_TEMP_OFFSET,
+    SYSMON_PL_BASEADDR + SYSMON_SUPPLY1_OFFSET,
+    SYSMON_PL_BASEADDR + SYSMON_SUPPLY3_OFFSET,
+};
+
+static const char *const channel_name[TELEM_CHANNELS] = {
+    "PS temp", "PL temp", "VCCINT", "VCCBRAM",
+};
+
+static void acc_reset(void)
+{
+    u32 c;
+
+    acc.samples = 0;
+    for (c = 0; c < TELEM_CHANNELS; c++) {
+        acc.sum[c] = 0;
+        acc.min[c] = SYSMON_CODE_MASK;
+        acc.max[c] = 0;
+    }
+}
+
+static void telem_sample(void)
+{
+    u32 c, code;
+
+    for (c = 0; c < TELEM_CHANNELS; c++) {
+        code = Xil_In32(channel_reg[c]) & SYSMON_CODE_MASK;
+        acc.sum[c] += code;
+        if (code < acc.min[c]) {
+            acc.min[c] = code;
+        }
+        if (code > acc.max[c]) {
+            acc.max[c] = code;
+        }
+    }
+    acc.samples++;
+}
+
+static s32 code_to_value(u32 channel, u32 code)
+{
+    if (channel == TELEM_PS_TEMP || channel == TELEM_PL_TEMP) {
+        return (s32)(((u64)code * 509314U) / 655360U) - 28023;    /* 0.01 °C */
+    }
+    return (s32)((code * 3000U) >> 16);                             /* mV */
+}
+
+/*******************************************************************************
+ * TTC0 + GIC
+ ******************************************************************************/
+#if TELEM_HAS_TIMER
+
+static XScuGic gic;
+static XTtcPs ttc;
+static int timer_state;         /* 0 = 미초기화, 1 = 준비, -1 = 초기화 실패 */
+
+static void telem_isr(void *ref)
+{
+    XTtcPs *t = (XTtcPs *)ref;
+
+    XTtcPs_ClearInterruptStatus(t, XTtcPs_GetInterruptStatus(t));
+    telem_sample();
+}
+
+static int timer_init(void)
+{
+    XScuGic_Config *gc;
+    XTtcPs_Config *tc;
+    XInterval interval;
+    u8 prescaler;
+    s32 status;
+
+    if (timer_state != 0) {
+        return timer_state > 0;
+    }
+    timer_state = -1;
+
+    gc = XScuGic_LookupConfig(XPAR_SCUGIC_SINGLE_DEVICE_ID);
+    if (gc == NULL || XScuGic_CfgInitialize(&gic, gc, gc->CpuBaseAddress) != XST_SUCCESS) {
+        return 0;
+    }
+    tc = XTtcPs_LookupConfig(TELEM_TTC_DEVICE_ID);
+    if (tc == NULL) {
+        return 0;
+    }
+    status = XTtcPs_CfgInitialize(&ttc, tc, tc->BaseAddress);
+    if (status == XST_DEVICE_IS_STARTED) {
+        /* 이전 실행(JTAG 재로드)이 남긴 타이머 */
+        XTtcPs_Stop(&ttc);
+        status = XTtcPs_CfgInitialize(&ttc, tc, tc->BaseAddress);
+    }
+    if (status != XST_SUCCESS) {
+        return 0;
+    }
+
+    XTtcPs_SetOptions(&ttc, XTTCPS_OPTION_INTERVAL_MODE | XTTCPS_OPTION_WAVE_DISABLE);
+    XTtcPs_CalcIntervalFromFreq(&ttc, TELEM_SAMPLE_HZ, &interval, &prescaler);
+    if (prescaler == 0xFF) {
+        return 0;
+    }
+    XTtcPs_SetInterval(&ttc, interval);
+    XTtcPs_SetPrescaler(&ttc, prescaler);
+
+    Xil_ExceptionInit();
+    Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+                                 (Xil_ExceptionHandler)XScuGic_InterruptHandler, &gic);
+    if (XScuGic_Connect(&gic, TELEM_TTC_INTR, (Xil_InterruptHandler)telem_isr, &ttc) != XST_SUCCESS) {
+        return 0;
+    }
+    XScuGic_SetPriorityTriggerType(&gic, TELEM_TTC_INTR, TELEM_IRQ_PRIORITY, 0x3);
+    XScuGic_Enable(&gic, TELEM_TTC_INTR);
+    XTtcPs_EnableInterrupts(&ttc, XTTCPS_IXR_INTERVAL_MASK);
+    Xil_ExceptionEnable();
+
+    timer_state = 1;
+    return 1;
+}
+
+#endif /* TELEM_HAS_TIMER */
+
+static void irq_mask(void)
+{
+#if TELEM_HAS_TIMER
+    Xil_ExceptionDisable();
+#endif
+}
+
+static void irq_unmask(void)
+{
+#if TELEM_HAS_TIMER
+    if (timer_state > 0) {
+        Xil_ExceptionEnable();
+    }
+#endif
+}
+
+/*******************************************************************************
+ * 구간 API
+ ******************************************************************************/
+int telem_start(void)
+{
+    irq_mask();
+    acc_reset();
+    telem_sample();
+    irq_unmask();
+
+#if TELEM_HAS_TIMER
+    if (timer_init()) {
+        XTtcPs_ResetCounterValue(&ttc);
+        XTtcPs_Start(&ttc);
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+void telem_stop(void)
+{
+#if TELEM_HAS_TIMER
+    if (timer_state > 0) {
+        XTtcPs_Stop(&ttc);
+    }
+#endif
+}
+
+void telem_pause(void)
+{
+    irq_mask();
+}
+
+void telem_resume(void)
+{
+    irq_unmask();
+}
+
+void telem_window(telem_stats_t *st)
+{
+    u32 c, n;
+
+    irq_mask();
+    if (acc.samples == 0) {
+        telem_sample();
+    }
+    n = acc.samples;
+    st->samples = n;
+    for (c = 0; c < TELEM_CHANNELS; c++) {
+        st->ch[c].avg = code_to_value(c, (u32)((acc.sum[c] + n / 2) / n));
+        st->ch[c].min = code_to_value(c, acc.min[c]);
+        st->ch[c].max = code_to_value(c, acc.max[c]);
+    }
+    acc_reset();
+    irq_unmask();
+}
+
+/*******************************************************************************
+ * 메뉴 21
+ ******************************************************************************/
+/* 채널 단위 값 출력 (온도는 0.01 °C 고정소수점, 음수 가능) */
+static void print_value(u32 channel, s32 v)
+{
+    if (channel == TELEM_PS_TEMP || channel == TELEM_PL_TEMP) {
+        if (v < 0) {
+            xil_printf("-");
+            v = -v;
+        }
+        xil_printf("%4d.%02d C", v / 100, v % 100);
+    } else {
+        xil_printf("%6d mV", v);
+    }
+}
+
+static void print_stats(const telem_stats_t *st)
+{
+    u32 c;
+
+    xil_printf("  Channel    avg        min        max\r\n");
+    for (c = 0; c < TELEM_CHANNELS; c++) {
+        xil_printf("  %-8s   ", channel_name[c]);
+        print_value(c, st->ch[c].avg);
+        xil_printf("  ");
+        print_value(c, st->ch[c].min);
+        xil_printf("  ");
+        print_value(c, st->ch[c].max);
+        xil_printf("\r\n");
+    }
+}
+
+/**
+ * @brief 현재 SYSMON 값, 처리량 측정 중 샘플 통계와 샘플러 오버헤드 출력
+ */
+void test_telemetry(void)
+{
+    bench_throughput_t off, on;
+    telem_stats_t st;
+    XTime t0, t;
+    u32 expected;
+    int timer;
+
+    xil_printf("=== SYSMON Telemetry ===\r\n");
+
+    timer = telem_start();
+    telem_stop();
+    if (timer) {
+        xil_printf("Sampler: TTC interval interrupt, %d Hz\r\n", TELEM_SAMPLE_HZ);
+    } else {
+        xil_printf("Sampler: no TTC timer - one sample per benchmark record\r\n");
+    }
+    telem_window(&st);
+    xil_printf("\r\nCurrent:\r\n");
+    print_stats(&st);
+
+    /* 같은 처리량 측정을 샘플러 없이 / 샘플러 실행 중에 */
+    bench_bram_throughput(&off, TELEM_BENCH_ROUNDS);
+    telem_start();
+    t0 = bench_now();
+    bench_bram_throughput(&on, TELEM_BENCH_ROUNDS);
+    t = bench_now() - t0;
+    telem_stop();
+    telem_window(&st);
+
+    xil_printf("\r\nDuring throughput run (%d rounds, %d us):\r\n",
+               TELEM_BENCH_ROUNDS, bench_ticks_to_us(t));
+    print_stats(&st);
+
+    expected = (u32)(((u64)t * TELEM_SAMPLE_HZ) / COUNTS_PER_SECOND) + 1;
+    xil_printf("  Samples: %d (expected %d)\r\n", st.samples, timer ? expected : 1);
+
+    xil_printf("\r\n  Sampler  Write MB/s  Read MB/s\r\n");
+    xil_printf("  off      ");
+    bench_print_x100(off.write_mbps_x100, 10);
+    xil_printf("  ");
+    bench_print_x100(off.read_mbps_x100, 9);
+    xil_printf("\r\n  on       ");
+    bench_print_x100(on.write_mbps_x100, 10);
+    xil_printf("  ");
+    bench_print_x100(on.read_mbps_x100, 9);
+    xil_printf("\r\n");
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+}
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - SYSMON 텔레메트리
+ *
+ * File: bram_telem.h
+ * Description: 벤치마크 실행 중 PS/PL SYSMON(온도, VCCINT, VCCBRAM)을
+ *              TTC 타이머 인터럽트로 일정 주기 샘플링하고 구간 통계를
+ *              결과 레코드(@BENCH)에 첨부
+ *
+ * 샘플링 구간:
+ *   bench_result_begin  → telem_start (샘플러 시작)
+ *   bench_result_add    → telem_window (이전 add 이후 샘플 통계, 구간 리셋)
+ *   bench_result_flush  → telem_stop
+ *   bench_read_latency  → telem_pause / telem_resume (지연 샘플에 ISR이 섞이지 않게)
+ ******************************************************************************/
+
+#ifndef BRAM_TELEM_H
+#define BRAM_TELEM_H
+
+#include "xil_types.h"
+
+/* AMS SYSMON 레지스터 (UG1087, 하위 16비트 = ADC 코드) */
+#define SYSMON_PS_BASEADDR      0xFFA50800U
+#define SYSMON_PL_BASEADDR      0xFFA50C00U
+#define SYSMON_TEMP_OFFSET      0x000U
+#define SYSMON_SUPPLY1_OFFSET   0x004U      /* PL: VCCINT */
+#define SYSMON_SUPPLY3_OFFSET   0x018U      /* PL: VCCBRAM */
+
+/* 샘플링 주기 (Hz) - Vitis Symbols에서 변경 가능 */
+#ifndef TELEM_SAMPLE_HZ
+#define TELEM_SAMPLE_HZ         1000
+#endif
+
+/* 채널 (온도 단위 0.01 °C, 전압 단위 mV) */
+#define TELEM_PS_TEMP           0
+#define TELEM_PL_TEMP           1
+#define TELEM_VCCINT            2
+#define TELEM_VCCBRAM           3
+#define TELEM_CHANNELS          4
+
+typedef struct {
+    s32 avg;
+    s32 min;
+    s32 max;
+} telem_value_t;
+
+typedef struct {
+    u32 samples;            /* 구간 샘플 수 (1 이상) */
+    telem_value_t ch[TELEM_CHANNELS];
+} telem_stats_t;
+
+/**
+ * @brief 샘플링 구간 시작 (구간 리셋, 즉시 1회 샘플, 타이머 시작)
+ * @return 1 = 타이머 샘플링, 0 = TTC/GIC 없음 (telem_window 호출 시에만 샘플)
+ */
+int telem_start(void);
+
+/* 타이머 정지 (진행 중 구간의 샘플은 유지) */
+void telem_stop(void);
+
+/**
+ * @brief 샘플러 인터럽트 마스크 / 해제 (구간은 유지)
+ * 마스크 중에 온 tick은 resume 직후 한 번 처리되므로 샘플이 하나 늦어질 뿐입니다.
+ */
+void telem_pause(void);
+void telem_resume(void);
+
+/**
+ * @brief 현재 구간 통계를 꺼내고 구간 리셋
+ *
+ * 구간에 샘플이 없으면 (타이머 주기보다 짧은 측정) 그 자리에서 1회 샘플합니다.
+ */
+void telem_window(telem_stats_t *st);
+
+/* 메뉴 21 */
+void test_telemetry(void);
+
+#endif /* BRAM_TELEM_H */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - 공통 정의
+ *
+ * File: bram_test.h
+ * Description: BRAM 메모리 맵과 main.c의 기본 액세스/입력 함수 선언
+ *              (main.c 및 확장 모듈에서 공용으로 사용)
+ ******************************************************************************/
+
+#ifndef BRAM_TEST_H
+#define BRAM_TEST_H
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+/*******************************************************************************
+ * 메모리 맵
+ ******************************************************************************/
+/* BRAM 베이스 주소 - xparameters.h에서 자동 생성되지만 명시적으로 정의 */
+#ifndef XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
+#define XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR  0x80000000U
+#endif
+
+#define BRAM_BASE_ADDR      XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
+#define BRAM_SIZE_BYTES     (8 * 1024)          /* 8KB */
+#define BRAM_SIZE_WORDS     (BRAM_SIZE_BYTES / 4)  /* 2048 words */
+#define BRAM_MAX_OFFSET     (BRAM_SIZE_WORDS - 1)
+
+/* 비트스트림 빌드 시 PL 클럭 (create_project.tcl -pl_clk 값과 일치시킬 것) */
+#ifndef BRAM_PL_CLK_MHZ
+#define BRAM_PL_CLK_MHZ     100
+#endif
+
+/* ECC 빌드 여부 (create_project.tcl -ecc 값과 일치시킬 것)
+ * xparameters.h에 BRAM 드라이버 파라미터가 있으면 그 값을 사용 */
+#ifndef BRAM_ECC_ENABLED
+#ifdef XPAR_AXI_BRAM_CTRL_0_ECC
+#define BRAM_ECC_ENABLED    XPAR_AXI_BRAM_CTRL_0_ECC
+#else
+#define BRAM_ECC_ENABLED    0
+#endif
+#endif
+
+#ifndef XPAR_AXI_BRAM_CTRL_0_S_AXI_CTRL_BASEADDR
+#define XPAR_AXI_BRAM_CTRL_0_S_AXI_CTRL_BASEADDR  0x80200000U
+#endif
+#define BRAM_ECC_CTRL_ADDR  XPAR_AXI_BRAM_CTRL_0_S_AXI_CTRL_BASEADDR
+
+/* 멀티 뱅크 빌드 (create_project.tcl -banks 값과 일치시킬 것, 1 = 기존 BRAM만)
+ * 뱅크 i는 HPM(i % 2)_FPD 뒤에 있고 포트 안에서 8KB 간격으로 배치됨 */
+#ifndef BRAM_BANK_COUNT
+#define BRAM_BANK_COUNT     1
+#endif
+#define BRAM_BANK_HPM0_BASE 0xA0000000U
+#define BRAM_BANK_HPM1_BASE 0xB0000000U
+
+/* AXI-Stream ingest 빌드 (create_project.tcl -stream 값과 일치시킬 것)
+ * PL writer가 BRAM 포트 B로 프레임을 쓰고, 제어/카운터는 AXI-Lite 레지스터 */
+#ifndef BRAM_STREAM_ENABLED
+#define BRAM_STREAM_ENABLED 0
+#endif
+
+#ifndef XPAR_STREAM_INGEST_0_BASEADDR
+#define XPAR_STREAM_INGEST_0_BASEADDR  0x80210000U
+#endif
+#define BRAM_STREAM_CTRL_ADDR   XPAR_STREAM_INGEST_0_BASEADDR
+
+/* HLS 벡터 커널 빌드 (create_project.tcl -kernel 값과 일치시킬 것)
+ * 커널이 BRAM 포트 B에서 범위를 in-place로 처리, 시작/인자는 AXI-Lite */
+#ifndef BRAM_KERNEL_ENABLED
+#define BRAM_KERNEL_ENABLED 0
+#endif
+
+#ifndef XPAR_BRAM_VEC_0_S_AXI_CONTROL_BASEADDR
+#define XPAR_BRAM_VEC_0_S_AXI_CONTROL_BASEADDR  0x80220000U
+#endif
+#define BRAM_KERNEL_CTRL_ADDR   XPAR_BRAM_VEC_0_S_AXI_CONTROL_BASEADDR
+
+/* 레지스터 창은 BRAM과 다른 2MB MMU 블록(0x80200000~)에 둡니다.
+ * bram_access_set_cached()가 BRAM 블록 전체를 Normal WB로 바꾸기 때문 */
+#define BRAM_MMU_BLOCK(addr)    ((addr) >> 21)
+#if BRAM_MMU_BLOCK(BRAM_ECC_CTRL_ADDR) == BRAM_MMU_BLOCK(BRAM_BASE_ADDR) || \
+    BRAM_MMU_BLOCK(BRAM_STREAM_CTRL_ADDR) == BRAM_MMU_BLOCK(BRAM_BASE_ADDR) || \
+    BRAM_MMU_BLOCK(BRAM_KERNEL_CTRL_ADDR) == BRAM_MMU_BLOCK(BRAM_BASE_ADDR)
+#error "PL register windows must not share the BRAM 2MB MMU block"
+#endif
+
+/* OCM 실행 프로파일(lscript_ocm.ld)에서 OCM으로 옮길 핫 코드 표시.
+ * 기본 링커 스크립트에서는 일반 코드와 함께 DDR에 남습니다. */
+#define BRAM_HOT            __attribute__((section(".ocm_text"), noinline))
+
+/*******************************************************************************
+ * main.c 함수 (확장 모듈에서 사용)
+ ******************************************************************************/
+/* 메뉴/입력 */
+void print_separator(void);
+int get_user_input(void);
+u32 get_hex_input(const char *prompt);
+u32 get_dec_input(const char *prompt);
+
+/* BRAM 기본 액세스 */
+void bram_write_single(u32 offset, u32 data);
+u32 bram_read_single(u32 offset);
+void bram_write_multiple(u32 start_offset, u32 *data, u32 count);
+void bram_read_multiple(u32 start_offset, u32 *data, u32 count);
+void bram_fill_all(u32 value);
+
+#endif /* BRAM_TEST_H */
@@ -22,19 +22,25 @@
 #include "xil_cache.h"
 #include "xparameters.h"
 #include "sleep.h"
+#include "bram_test.h"
+#include "pl_clock.h"
+#include "bram_access.h"
+#include "bram_ecc.h"
+#include "bram_byte.h"
+#include "bram_bench.h"
+#include "bram_autorun.h"
+#include "bram_ocm.h"
+#include "bram_bank.h"
+#include "bram_matrix.h"
+#include "bram_snap.h"
+#include "bram_telem.h"
+#include "bram_stream.h"
+#include "bram_offload.h"
 
 /*******************************************************************************
  * 매크로 정의
  ******************************************************************************/
-/* BRAM 베이스 주소 - xparameters.h에서 자동 생성되지만 명시적으로 정의 */
-#ifndef XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
-#define XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR  0x80000000U
-#endif
-
-#define BRAM_BASE_ADDR      XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
-#define BRAM_SIZE_BYTES     (8 * 1024)          /* 8KB */
-#define BRAM_SIZE_WORDS     (BRAM_SIZE_BYTES / 4)  /* 2048 words */
-#define BRAM_MAX_OFFSET     (BRAM_SIZE_WORDS - 1)
+/* BRAM 메모리 맵(BRAM_BASE_ADDR, BRAM_SIZE_*)은 bram_test.h 참조 */
 
 /* 테스트 패턴 */
 #define PATTERN_INCREMENT   0x00000001
@@ -53,20 +59,11 @@ static char input_buffer[INPUT_BUFFER_SIZE];
 /*******************************************************************************
  * 함수 선언
  ******************************************************************************/
-/* 메뉴 함수 */
+/* 메뉴 함수 (입력 함수는 bram_test.h) */
 void print_main_menu(void);
-void print_separator(void);
 void clear_input_buffer(void);
-int get_user_input(void);
-u32 get_hex_input(const char *prompt);
-u32 get_dec_input(const char *prompt);
-
-/* BRAM 기본 액세스 함수 */
-void bram_write_single(u32 offset, u32 data);
-u32 bram_read_single(u32 offset);
-void bram_write_multiple(u32 start_offset, u32 *data, u32 count);
-void bram_read_multiple(u32 start_offset, u32 *data, u32 count);
-void bram_fill_all(u32 value);
+
+/* BRAM 기본 액세스 함수 (나머지는 bram_test.h) */
 void bram_read_all(void);
 
 /* 테스트 함수 */
@@ -88,6 +85,24 @@ void print_bram_info(void);
 /*******************************************************************************
  * 메인 함수
  ******************************************************************************/
+#ifdef BRAM_HEADLESS
+/**
+ * @brief 헤드리스 프로파일: 메뉴/정보 출력 없이 자가 테스트만 실행
+ *
+ * BRAM은 변환 테이블에서 Device 메모리이므로 D-Cache를 켜 두어도
+ * BRAM 액세스는 그대로 AXI로 나가고, 코드/스택만 캐시 이득을 봅니다.
+ */
+int main(void)
+{
+    XTime boot = bench_now();   /* 시스템 카운터 시작 이후 경과 */
+
+    bram_ocm_init();
+
+    return bram_autorun(boot) == 0 ? 0 : 1;
+}
+
+#else /* !BRAM_HEADLESS */
+
 int main(void)
 {
     int choice;
@@ -96,6 +111,9 @@ int main(void)
     /* 캐시 비활성화 (ILA 디버깅을 위해 - 모든 액세스가 실제로 AXI 버스로 전송됨) */
     Xil_DCacheDisable();
 
+    /* OCM 실행 프로파일이면 핫 코드를 OCM으로 복사 (BRAM 액세스 함수 호출 전) */
+    bram_ocm_init();
+
     /* 초기화 메시지 */
     xil_printf("\r\n");
     xil_printf("============================================================\r\n");
@@ -162,6 +180,7 @@ int main(void)
             case 11:
                 xil_printf("Clearing all BRAM to 0x00000000...\r\n");
                 bram_fill_all(0x00000000);
+                snap_mark_dirty(0, BRAM_SIZE_WORDS);
                 xil_printf("Done!\r\n");
                 break;
 
@@ -170,6 +189,43 @@ int main(void)
                 print_bram_info();
                 break;
 
+            /* 성능 측정 */
+            case 13:
+                test_pl_clock_sweep();
+                break;
+            case 14:
+                test_access_bench();
+                break;
+            case 15:
+                test_ecc();
+                break;
+            case 16:
+                test_byte_access();
+                break;
+            case 17:
+                test_ocm_bench();
+                break;
+            case 18:
+                test_bank_interleave();
+                break;
+            case 19:
+                test_access_matrix();
+                break;
+            case 20:
+                test_snapshot();
+                break;
+            case 21:
+                test_telemetry();
+                break;
+
+            /* PL 데이터 경로 */
+            case 22:
+                test_stream_ingest();
+                break;
+            case 23:
+                test_vec_offload();
+                break;
+
             /* 종료 */
             case 0:
                 running = 0;
@@ -219,11 +275,30 @@ void print_main_menu(void)
     xil_printf("   11. Clear All BRAM\r\n");
     xil_printf("   12. Show BRAM Info\r\n");
     xil_printf("\r\n");
+    xil_printf("  [Performance]\r\n");
+    xil_printf("   13. PL Clock Sweep (throughput vs clock)\r\n");
+    xil_printf("   14. Access Kernel Benchmark (cycles/word)\r\n");
+    xil_printf("   15. ECC Test (inject / scrub / cost)\r\n");
+    xil_printf("   16. Byte/Halfword Access (narrow vs RMW)\r\n");
+    xil_printf("   17. OCM vs DDR Loop Cost\r\n");
+    xil_printf("   18. Multi-Bank Interleave (scaling)\r\n");
+    xil_printf("   19. Access Pattern Matrix (latency / bandwidth)\r\n");
+    xil_printf("\r\n");
+    xil_printf("  [Debug]\r\n");
+    xil_printf("   20. Snapshot / Diff (changed ranges only)\r\n");
+    xil_printf("   21. SYSMON Telemetry (temperature / voltage)\r\n");
+    xil_printf("\r\n");
+    xil_printf("  [PL Data Path]\r\n");
+    xil_printf("   22. AXI-Stream Ingest (rate / drops / backpressure)\r\n");
+    xil_printf("   23. PL Vector Kernel Offload (kernel vs A53)\r\n");
+    xil_printf("\r\n");
     xil_printf("    0. Exit\r\n");
     print_separator();
     xil_printf("Enter your choice: ");
 }
 
+#endif /* BRAM_HEADLESS */
+
 void print_separator(void)
 {
     xil_printf("------------------------------------------------------------\r\n");
@@ -341,12 +416,15 @@ u32 get_dec_input(const char *prompt)
  * BRAM 기본 액세스 함수
  ******************************************************************************/
 
+#ifndef BRAM_ACCESS_CPP
+/* BRAM_ACCESS_CPP 빌드에서는 bram_access.cpp의 템플릿 구현을 사용 */
+
 /**
  * @brief 단일 워드 쓰기
  * @param offset 워드 오프셋 (0 ~ BRAM_MAX_OFFSET)
  * @param data 쓸 데이터
  */
-void bram_write_single(u32 offset, u32 data)
+BRAM_HOT void bram_write_single(u32 offset, u32 data)
 {
     u32 addr = BRAM_BASE_ADDR + (offset * 4);
     Xil_Out32(addr, data);
@@ -357,7 +435,7 @@ void bram_write_single(u32 offset, u32 data)
  * @param offset 워드 오프셋 (0 ~ BRAM_MAX_OFFSET)
  * @return 읽은 데이터
  */
-u32 bram_read_single(u32 offset)
+BRAM_HOT u32 bram_read_single(u32 offset)
 {
     u32 addr = BRAM_BASE_ADDR + (offset * 4);
     return Xil_In32(addr);
@@ -369,7 +447,7 @@ u32 bram_read_single(u32 offset)
  * @param data 데이터 배열 포인터
  * @param count 쓸 워드 개수
  */
-void bram_write_multiple(u32 start_offset, u32 *data, u32 count)
+BRAM_HOT void bram_write_multiple(u32 start_offset, u32 *data, u32 count)
 {
     u32 i;
     u32 addr;
@@ -386,7 +464,7 @@ void bram_write_multiple(u32 start_offset, u32 *data, u32 count)
  * @param data 데이터 저장 배열 포인터
  * @param count 읽을 워드 개수
  */
-void bram_read_multiple(u32 start_offset, u32 *data, u32 count)
+BRAM_HOT void bram_read_multiple(u32 start_offset, u32 *data, u32 count)
 {
     u32 i;
     u32 addr;
@@ -401,7 +479,7 @@ void bram_read_multiple(u32 start_offset, u32 *data, u32 count)
  * @brief 전체 BRAM을 특정 값으로 채우기
  * @param value 채울 값
  */
-void bram_fill_all(u32 value)
+BRAM_HOT void bram_fill_all(u32 value)
 {
     u32 i;
     u32 addr;
@@ -412,6 +490,10 @@ void bram_fill_all(u32 value)
     }
 }
 
+#endif /* BRAM_ACCESS_CPP */
+
+#ifndef BRAM_HEADLESS
+
 /**
  * @brief 전체 BRAM 읽기 (요약 출력)
  */
@@ -473,6 +555,7 @@ void test_write_single(void)
                data, offset, BRAM_BASE_ADDR + (offset * 4));
 
     bram_write_single(offset, data);
+    snap_mark_dirty(offset, 1);
 
     /* 검증 읽기 */
     u32 readback = bram_read_single(offset);
@@ -562,6 +645,7 @@ void test_write_multiple(void)
     xil_printf("\r\nWriting %d words starting at offset %d...\r\n", count, start_offset);
 
     bram_write_multiple(start_offset, data_buffer, count);
+    snap_mark_dirty(start_offset, count);
 
     xil_printf("Write complete! Verifying...\r\n");
 
@@ -599,6 +683,7 @@ void test_fill_all(void)
     xil_printf("\r\nFilling all %d words with 0x%08X...\r\n", BRAM_SIZE_WORDS, value);
 
     bram_fill_all(value);
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
 
     xil_printf("Fill complete!\r\n");
 
@@ -756,6 +841,7 @@ void test_pattern_write(void)
             xil_printf("Invalid choice!\r\n");
             return;
     }
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
 
     xil_printf("Pattern write complete!\r\n");
 }
@@ -860,6 +946,7 @@ void test_ila_burst(void)
             for (i = 0; i < 100; i++) {
                 bram_write_single(i, 0xDEAD0000 | i);
             }
+            snap_mark_dirty(0, 100);
             xil_printf("Write burst complete!\r\n");
             break;
 
@@ -879,6 +966,7 @@ void test_ila_burst(void)
                 dummy = bram_read_single(i);
             }
             (void)dummy;
+            snap_mark_dirty(0, 50);
             xil_printf("Mixed burst complete!\r\n");
             break;
 
@@ -894,6 +982,7 @@ void test_ila_burst(void)
                 for (i = 0; i < count; i++) {
                     bram_write_single(i % BRAM_SIZE_WORDS, 0xCAFE0000 | i);
                 }
+                snap_mark_dirty(0, count);
                 xil_printf("Custom burst complete!\r\n");
             }
             break;
@@ -939,6 +1028,8 @@ void hex_dump(u32 start_offset, u32 count)
     }
 }
 
+#endif /* BRAM_HEADLESS */
+
 /**
  * @brief 오프셋 유효성 검사
  */
@@ -951,6 +1042,8 @@ int validate_offset(u32 offset)
     return 1;
 }
 
+#ifndef BRAM_HEADLESS
+
 /**
  * @brief BRAM 정보 출력
  */
@@ -962,6 +1055,14 @@ void print_bram_info(void)
     xil_printf("  - Size:         %d bytes (%d KB)\r\n", BRAM_SIZE_BYTES, BRAM_SIZE_BYTES/1024);
     xil_printf("  - Word Count:   %d (32-bit words)\r\n", BRAM_SIZE_WORDS);
     xil_printf("  - Valid Offset: 0 to %d\r\n", BRAM_MAX_OFFSET);
+    xil_printf("  - PL Clock:     %d kHz (built for %d MHz)\r\n",
+               pl_clock_get_khz(), BRAM_PL_CLK_MHZ);
+#if BRAM_BANK_COUNT > 1
+    xil_printf("  - FPD Banks:    %d x %d KB (HPM0_FPD 0x%08X, HPM1_FPD 0x%08X)\r\n",
+               BRAM_BANK_COUNT, BRAM_SIZE_BYTES / 1024, BRAM_BANK_HPM0_BASE, BRAM_BANK_HPM1_BASE);
+#endif
     xil_printf("\r\n");
     xil_printf("Note: Data Cache is DISABLED for accurate ILA debugging.\r\n");
 }
+
+#endif /* BRAM_HEADLESS */
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - PL 클럭 런타임 제어
+ *
+ * File: pl_clock.c
+ * Description: CRL_APB PL0_REF_CTRL 분주기를 변경하여 하나의 비트스트림으로
+ *              PL 클럭(pl_clk0)을 스윕하고 BRAM 처리량을 측정
+ *
+ * 소스 PLL 주파수는 PL0_REF_CTRL SRCSEL이 가리키는 IOPLL / RPLL / DPLL의
+ * 설정 레지스터(FBDIV, DIV2, 분수 모드)와 PS_REF_CLK로 계산합니다. 읽을 수 없는
+ * 설정(PS_REF_CLK 외 입력 등)일 때만 빌드 심볼 BRAM_PL_CLK_MHZ로 역산합니다.
+ * 부팅 시 클럭은 FSBL이 비트스트림의 설정으로 맞춘 값이므로, 그보다 높은
+ * 주파수(타이밍 미검증)는 스윕하지 않습니다.
+ ******************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "sleep.h"
+#include "bram_test.h"
+#include "bram_bench.h"
+#include "pl_clock.h"
+#include "bram_result.h"
+#include "bram_snap.h"
+
+#define PL_CLOCK_SETTLE_US  100
+#define SWEEP_ROUNDS        16
+
+static u32 boot_ref_ctrl = 0;   /* 부팅 시 PL0_REF_CTRL (복원용) */
+static u64 src_hz = 0;          /* 소스 PLL 출력 주파수 */
+static const char *src_name = "";
+
+static u32 ref_ctrl_div(u32 reg)
+{
+    u32 div0 = (reg >> PL_REF_CTRL_DIV0_SHIFT) & PL_REF_CTRL_DIV_MASK;
+    u32 div1 = (reg >> PL_REF_CTRL_DIV1_SHIFT) & PL_REF_CTRL_DIV_MASK;
+
+    if (div0 == 0) div0 = 1;
+    if (div1 == 0) div1 = 1;
+    return div0 * div1;
+}
+
+/* PLL 출력 (Hz), PS_REF_CLK 입력이 아니면 0 */
+static u64 pll_out_hz(u32 ctrl, u32 frac_cfg)
+{
+    u64 fb;
+
+    if (((ctrl >> PLL_CTRL_PRE_SRC_SHIFT) & PLL_CTRL_PRE_SRC_MASK) != 0) {
+        return 0;
+    }
+    if (ctrl & PLL_CTRL_BYPASS) {
+        return PL_CLOCK_PS_REF_HZ;
+    }
+    /* FBDIV x 65536 + 분수부 */
+    fb = (u64)((ctrl >> PLL_CTRL_FBDIV_SHIFT) & PLL_CTRL_FBDIV_MASK) << 16;
+    if (frac_cfg & PLL_FRAC_CFG_ENABLED) {
+        fb += frac_cfg & PLL_FRAC_CFG_DATA_MASK;
+    }
+    fb = ((u64)PL_CLOCK_PS_REF_HZ * fb) >> 16;
+    return (ctrl & PLL_CTRL_DIV2) ? fb / 2 : fb;
+}
+
+static u64 source_hz(u32 ref_ctrl)
+{
+    u32 div;
+
+    switch (ref_ctrl & PL_REF_CTRL_SRCSEL_MASK) {
+        case PL_REF_CTRL_SRC_IOPLL:
+            src_name = "IOPLL";
+            return pll_out_hz(Xil_In32(CRL_APB_IOPLL_CTRL), Xil_In32(CRL_APB_IOPLL_FRAC_CFG));
+        case PL_REF_CTRL_SRC_RPLL:
+            src_name = "RPLL";
+            return pll_out_hz(Xil_In32(CRL_APB_RPLL_CTRL), Xil_In32(CRL_APB_RPLL_FRAC_CFG));
+        case PL_REF_CTRL_SRC_DPLL:
+            src_name = "DPLL_TO_LPD";
+            div = (Xil_In32(CRF_APB_DPLL_TO_LPD_CTRL) >> PL_REF_CTRL_DIV0_SHIFT) &
+                  PL_REF_CTRL_DIV_MASK;
+            return pll_out_hz(Xil_In32(CRF_APB_DPLL_CTRL), Xil_In32(CRF_APB_DPLL_FRAC_CFG)) /
+                   (div ? div : 1);
+        default:
+            src_name = "unknown";
+            return 0;
+    }
+}
+
+static void pl_clock_init(void)
+{
+    if (src_hz != 0) {
+        return;
+    }
+    boot_ref_ctrl = Xil_In32(CRL_APB_PL0_REF_CTRL);
+    src_hz = source_hz(boot_ref_ctrl);
+    if (src_hz == 0) {
+        /* PLL 설정을 해석할 수 없으면 빌드 클럭으로 역산 */
+        src_name = "derived from BRAM_PL_CLK_MHZ";
+        src_hz = (u64)ref_ctrl_div(boot_ref_ctrl) * BRAM_PL_CLK_MHZ * 1000000;
+    }
+}
+
+static u32 khz_for_div(u32 div)
+{
+    return (u32)((src_hz / div + 500) / 1000);
+}
+
+/**
+ * @brief 현재 PL0 클럭 (kHz)
+ */
+u32 pl_clock_get_khz(void)
+{
+    pl_clock_init();
+    return khz_for_div(ref_ctrl_div(Xil_In32(CRL_APB_PL0_REF_CTRL)));
+}
+
+/**
+ * @brief PL0 클럭을 목표 주파수에 가장 가깝게 설정 (목표 이하만 선택)
+ * @param mhz 목표 주파수 (MHz)
+ * @return 실제 설정된 주파수 (kHz), 설정 불가 시 0
+ */
+u32 pl_clock_set_mhz(u32 mhz)
+{
+    u32 target_khz = mhz * 1000;
+    u32 best_khz = 0, best_div0 = 0, best_div1 = 0;
+    u32 div0, div1, khz, reg;
+
+    pl_clock_init();
+
+    for (div1 = 1; div1 <= PL_REF_CTRL_DIV_MASK; div1++) {
+        for (div0 = 1; div0 <= PL_REF_CTRL_DIV_MASK; div0++) {
+            khz = khz_for_div(div0 * div1);
+            if (khz <= target_khz && khz > best_khz) {
+                best_khz = khz;
+                best_div0 = div0;
+                best_div1 = div1;
+            }
+        }
+    }
+    if (best_khz == 0) {
+        return 0;
+    }
+
+    /* SRCSEL/CLKACT는 유지하고 분주값만 교체 */
+    reg = Xil_In32(CRL_APB_PL0_REF_CTRL);
+    reg &= ~((PL_REF_CTRL_DIV_MASK << PL_REF_CTRL_DIV0_SHIFT) |
+             (PL_REF_CTRL_DIV_MASK << PL_REF_CTRL_DIV1_SHIFT));
+    reg |= (best_div0 << PL_REF_CTRL_DIV0_SHIFT) |
+           (best_div1 << PL_REF_CTRL_DIV1_SHIFT) |
+           PL_REF_CTRL_CLKACT;
+    Xil_Out32(CRL_APB_PL0_REF_CTRL, reg);
+    usleep(PL_CLOCK_SETTLE_US);
+
+    return best_khz;
+}
+
+/**
+ * @brief 부팅 시 PL0 클럭 설정으로 복원
+ */
+void pl_clock_restore(void)
+{
+    pl_clock_init();
+    Xil_Out32(CRL_APB_PL0_REF_CTRL, boot_ref_ctrl);
+    usleep(PL_CLOCK_SETTLE_US);
+}
+
+/**
+ * @brief PL 클럭 스윕 - 단계별 BRAM 처리량/검증 결과 출력
+ */
+void test_pl_clock_sweep(void)
+{
+    static const u32 steps_mhz[] = {100, 150, 200, 250, 300};
+    static const char *step_names[] = {"100 MHz", "150 MHz", "200 MHz", "250 MHz", "300 MHz"};
+    u32 num_steps = sizeof(steps_mhz) / sizeof(steps_mhz[0]);
+    bench_throughput_t tp;
+    bench_latency_t lat;
+    u32 i, khz, errors, boot_khz;
+
+    print_separator();
+    xil_printf("=== PL Clock Sweep ===\r\n");
+    print_separator();
+
+    pl_clock_init();
+    boot_khz = khz_for_div(ref_ctrl_div(boot_ref_ctrl));
+    xil_printf("Boot PL0:     %d kHz (bitstream clock)\r\n", boot_khz);
+    xil_printf("Current PL0:  %d kHz\r\n", pl_clock_get_khz());
+    xil_printf("Source PLL:   %d kHz (%s)\r\n", (u32)((src_hz + 500) / 1000), src_name);
+    if ((boot_khz + 500) / 1000 != BRAM_PL_CLK_MHZ) {
+        xil_printf("Note: BRAM_PL_CLK_MHZ=%d does not match the boot clock\r\n", BRAM_PL_CLK_MHZ);
+    }
+    xil_printf("Transfer:     %d KB per direction per step\r\n",
+               (SWEEP_ROUNDS * BRAM_SIZE_BYTES) / 1024);
+    xil_printf("\r\n");
+    xil_printf("Target   Actual(kHz)   Write MB/s   Read MB/s   Errors\r\n");
+    xil_printf("------   -----------   ----------   ---------   ------\r\n");
+
+    bench_result_begin("pl_sweep");
+    for (i = 0; i < num_steps; i++) {
+        if (steps_mhz[i] * 1000 > boot_khz + boot_khz / 100) {
+            xil_printf("%3d MHz  skipped (above build clock)\r\n", steps_mhz[i]);
+            continue;
+        }
+
+        khz = pl_clock_set_mhz(steps_mhz[i]);
+        if (khz == 0) {
+            xil_printf("%3d MHz  no valid divider\r\n", steps_mhz[i]);
+            continue;
+        }
+
+        errors = bench_bram_verify(steps_mhz[i]);
+        bench_bram_throughput(&tp, SWEEP_ROUNDS);
+        bench_read_latency(&lat);
+        bench_result_add(step_names[i], 32, 0, tp.write_mbps_x100, tp.read_mbps_x100, &lat);
+
+        xil_printf("%3d MHz  %11d   ", steps_mhz[i], khz);
+        bench_print_x100(tp.write_mbps_x100, 10);
+        xil_printf("   ");
+        bench_print_x100(tp.read_mbps_x100, 9);
+        xil_printf("   %6d\r\n", errors);
+    }
+
+    pl_clock_restore();
+    xil_printf("\r\nPL0 restored to %d kHz\r\n", pl_clock_get_khz());
+    /* 스윕 중 처리량 벤치마크가 BRAM 전체를 덮어씀 */
+    snap_mark_dirty(0, BRAM_SIZE_WORDS);
+    bench_result_flush();
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * KV260 BRAM AXI Test Application - PL 클럭 런타임 제어
+ *
+ * File: pl_clock.h
+ * Description: CRL_APB PL0_REF_CTRL 분주기를 변경하여 하나의 비트스트림으로
+ *              PL 클럭(pl_clk0)을 스윕하고 BRAM 처리량을 측정
+ ******************************************************************************/
+
+#ifndef PL_CLOCK_H
+#define PL_CLOCK_H
+
+#include "xil_types.h"
+
+/* CRL_APB PL0_REF_CTRL (UG1087) */
+#define CRL_APB_BASEADDR            0xFF5E0000U
+#define CRL_APB_PL0_REF_CTRL        (CRL_APB_BASEADDR + 0x000000C0U)
+#define PL_REF_CTRL_CLKACT          (1U << 24)
+#define PL_REF_CTRL_DIV1_SHIFT      16
+#define PL_REF_CTRL_DIV0_SHIFT      8
+#define PL_REF_CTRL_DIV_MASK        0x3FU
+#define PL_REF_CTRL_SRCSEL_MASK     0x7U
+#define PL_REF_CTRL_SRC_IOPLL       0x0U
+#define PL_REF_CTRL_SRC_RPLL        0x2U
+#define PL_REF_CTRL_SRC_DPLL        0x3U    /* DPLL_CLK_TO_LPD */
+
+/* 소스 PLL 설정 (UG1087 CRL_APB / CRF_APB) */
+#define CRL_APB_IOPLL_CTRL          (CRL_APB_BASEADDR + 0x00000020U)
+#define CRL_APB_IOPLL_FRAC_CFG      (CRL_APB_BASEADDR + 0x00000028U)
+#define CRL_APB_RPLL_CTRL           (CRL_APB_BASEADDR + 0x00000030U)
+#define CRL_APB_RPLL_FRAC_CFG       (CRL_APB_BASEADDR + 0x00000038U)
+#define CRF_APB_BASEADDR            0xFD1A0000U
+#define CRF_APB_DPLL_CTRL           (CRF_APB_BASEADDR + 0x0000002CU)
+#define CRF_APB_DPLL_FRAC_CFG       (CRF_APB_BASEADDR + 0x00000034U)
+#define CRF_APB_DPLL_TO_LPD_CTRL    (CRF_APB_BASEADDR + 0x00000068U)
+
+#define PLL_CTRL_PRE_SRC_SHIFT      20      /* 0 = PS_REF_CLK */
+#define PLL_CTRL_PRE_SRC_MASK       0x7U
+#define PLL_CTRL_DIV2               (1U << 16)
+#define PLL_CTRL_FBDIV_SHIFT        8
+#define PLL_CTRL_FBDIV_MASK         0x7FU
+#define PLL_CTRL_BYPASS             (1U << 3)
+#define PLL_FRAC_CFG_ENABLED        (1U << 31)
+#define PLL_FRAC_CFG_DATA_MASK      0xFFFFU
+
+/* PS_REF_CLK - xparameters.h에 없으면 KV260 기본값 */
+#ifdef XPAR_PSU_PSS_REF_CLK_FREQ_HZ
+#define PL_CLOCK_PS_REF_HZ          XPAR_PSU_PSS_REF_CLK_FREQ_HZ
+#else
+#define PL_CLOCK_PS_REF_HZ          33333333U
+#endif
+
+u32 pl_clock_get_khz(void);
+u32 pl_clock_set_mhz(u32 mhz);
+void pl_clock_restore(void);
+void test_pl_clock_sweep(void);
+
+#endif /* PL_CLOCK_H */
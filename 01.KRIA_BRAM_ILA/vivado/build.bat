@@ -16,6 +16,22 @@ echo.
 REM Vivado path - MODIFY THIS TO YOUR VIVADO INSTALLATION PATH
 set VIVADO_PATH=C:\Xilinx\Vivado\2022.2\bin\vivado.bat
 
+REM PL clock in MHz (100 / 150 / 200 / 250 / 300)
+set PL_CLK_MHZ=100
+
+REM BRAM ECC (0 = off, 1 = Hamming SEC-DED with fault injection)
+set BRAM_ECC=0
+
+REM Multi-bank BRAM on HPM0/HPM1_FPD (1 = single BRAM only, 2..4 = extra banks)
+set BRAM_BANKS=1
+
+REM AXI-Stream ingest into BRAM port B (0 = off, 1 = on; not with BRAM_ECC=1)
+set BRAM_STREAM=0
+
+REM HLS vector kernel on BRAM port B (0 = off, 1 = on; run hls\run_hls.tcl first,
+REM not with BRAM_STREAM=1 or BRAM_ECC=1)
+set BRAM_KERNEL=0
+
 REM Check if Vivado exists
 if not exist "%VIVADO_PATH%" (
     echo [ERROR] Vivado not found at: %VIVADO_PATH%
@@ -30,6 +46,11 @@ if not exist "%VIVADO_PATH%" (
 )
 
 echo Vivado found: %VIVADO_PATH%
+echo PL clock:     %PL_CLK_MHZ% MHz
+echo BRAM ECC:     %BRAM_ECC%
+echo BRAM banks:   %BRAM_BANKS%
+echo BRAM stream:  %BRAM_STREAM%
+echo BRAM kernel:  %BRAM_KERNEL%
 echo.
 
 :menu
@@ -41,6 +62,7 @@ echo   2. Build All (synth + impl + bitstream + xsa)
 echo   3. Create Project and Build All
 echo   4. Open Vivado GUI with project
 echo   5. Clean project
+echo   6. Run RTL testbench (xsim)
 echo   0. Exit
 echo ============================================================
 echo.
@@ -51,6 +73,7 @@ if "%choice%"=="2" goto build_all
 if "%choice%"=="3" goto create_and_build
 if "%choice%"=="4" goto open_gui
 if "%choice%"=="5" goto clean
+if "%choice%"=="6" goto sim
 if "%choice%"=="0" goto end
 
 echo Invalid choice!
@@ -60,7 +83,7 @@ goto menu
 echo.
 echo [INFO] Creating Vivado project...
 echo.
-call "%VIVADO_PATH%" -mode batch -source create_project.tcl
+call "%VIVADO_PATH%" -mode batch -source create_project.tcl -tclargs -pl_clk %PL_CLK_MHZ% -ecc %BRAM_ECC% -banks %BRAM_BANKS% -stream %BRAM_STREAM% -kernel %BRAM_KERNEL%
 if %errorlevel% neq 0 (
     echo [ERROR] Project creation failed!
     pause
@@ -92,7 +115,7 @@ goto menu
 echo.
 echo [INFO] Creating and building project...
 echo.
-call "%VIVADO_PATH%" -mode batch -source create_project.tcl
+call "%VIVADO_PATH%" -mode batch -source create_project.tcl -tclargs -pl_clk %PL_CLK_MHZ% -ecc %BRAM_ECC% -banks %BRAM_BANKS% -stream %BRAM_STREAM% -kernel %BRAM_KERNEL%
 if %errorlevel% neq 0 (
     echo [ERROR] Project creation failed!
     pause
@@ -153,6 +176,20 @@ echo [SUCCESS] Clean completed!
 pause
 goto menu
 
+:sim
+echo.
+echo [INFO] Running sim\tb_stream_ingest.v with xsim...
+echo.
+call "%VIVADO_PATH%" -mode batch -nojournal -nolog -source sim\run_tb.tcl -tclargs -sim xsim
+if %errorlevel% neq 0 (
+    echo [ERROR] Testbench failed!
+    pause
+    goto menu
+)
+echo [SUCCESS] tb_stream_ingest: PASS
+pause
+goto menu
+
 :end
 echo.
 echo Goodbye!
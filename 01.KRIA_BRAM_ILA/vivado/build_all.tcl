@@ -6,12 +6,16 @@
 
 set project_name "kv260_bram_ila"
 set project_dir  [file dirname [info script]]
+set variant_name "bram_ila"
+set build_start  [clock seconds]
 
 #------------------------------------------------------------------------------
 # 프로젝트 열기
 #------------------------------------------------------------------------------
-puts "Opening project..."
-open_project $project_dir/$project_name/$project_name.xpr
+if {[current_project -quiet] eq ""} {
+    puts "Opening project..."
+    open_project $project_dir/$project_name/$project_name.xpr
+}
 
 #------------------------------------------------------------------------------
 # Synthesis 실행
@@ -83,6 +87,24 @@ write_hw_platform -fixed -include_bit -force $xsa_file
 
 puts "Hardware platform exported to: $xsa_file"
 
+#------------------------------------------------------------------------------
+# 타이밍/리소스 리포트 (WNS/TNS, Fmax, LUT/FF/BRAM -> build_summary.json)
+#------------------------------------------------------------------------------
+puts "=============================================="
+puts "Writing Reports..."
+puts "=============================================="
+
+set report_dir "$project_dir/reports"
+file mkdir $report_dir
+
+report_timing_summary -file $report_dir/timing_summary.rpt
+report_utilization -file $report_dir/utilization.rpt
+
+source $project_dir/../../tools/report_summary.tcl
+report_summary::write $variant_name \
+    $report_dir/timing_summary.rpt $report_dir/utilization.rpt \
+    [expr {[clock seconds] - $build_start}] $project_dir/build_summary.json
+
 #------------------------------------------------------------------------------
 # ILA 프로브 파일 생성
 #------------------------------------------------------------------------------
@@ -105,6 +127,7 @@ puts ""
 puts "Generated files:"
 puts "- XSA: $xsa_file"
 puts "- LTX: $ltx_file"
+puts "- Summary: $project_dir/build_summary.json"
 puts "- Bitstream: $project_dir/$project_name/$project_name.runs/impl_1/design_1_wrapper.bit"
 puts ""
 puts "Next steps:"
@@ -13,6 +13,104 @@ set bd_name      "design_1"
 # KV260 Part Number (Zynq UltraScale+ MPSoC)
 set part_number "xck26-sfvc784-2LV-c"
 
+# 빌드 옵션 읽기: -tclargs -<name> 값 > source 전에 set 한 <var> > 기본값
+proc get_opt {name var default} {
+    upvar 1 $var value
+    if {![info exists value]} {
+        set value $default
+    }
+    if {[uplevel 1 {info exists argv}]} {
+        set opts [uplevel 1 {set argv}]
+        set idx [lsearch -exact $opts "-$name"]
+        if {$idx >= 0} {
+            set value [lindex $opts [expr {$idx + 1}]]
+        }
+    }
+    return $value
+}
+
+# PL 클럭 (pl_clk0, MHz) - 100 / 150 / 200 / 250 / 300
+# 사용법:
+#   vivado -mode batch -source create_project.tcl -tclargs -pl_clk 200
+#   또는 source 전에 Tcl Console에서: set pl_clk_mhz 200
+# 런타임 클럭 스윕(앱 메뉴 13)은 빌드 클럭 이하에서만 안전하므로
+# 스윕용 비트스트림은 가장 높은 목표 주파수로 빌드합니다.
+set pl_clk_choices {100 150 200 250 300}
+get_opt pl_clk pl_clk_mhz 100
+if {[lsearch -exact $pl_clk_choices $pl_clk_mhz] < 0} {
+    puts "ERROR: pl_clk_mhz must be one of: $pl_clk_choices (got '$pl_clk_mhz')"
+    return -code error "invalid pl_clk_mhz"
+}
+
+# BRAM ECC (Hamming SEC-DED) - 0 / 1
+# 사용법: -tclargs -ecc 1  (또는 source 전에 set bram_ecc 1)
+# ECC를 켜면 BRAM Controller에 ECC 레지스터(S_AXI_CTRL, 0x80200000)와
+# fault injection 레지스터가 추가되고, BRAM 폭은 32 + 8(ECC 레인) 비트가 됩니다.
+get_opt ecc bram_ecc 0
+if {$bram_ecc ni {0 1}} {
+    puts "ERROR: bram_ecc must be 0 or 1 (got '$bram_ecc')"
+    return -code error "invalid bram_ecc"
+}
+set bram_width [expr {$bram_ecc ? 40 : 32}]
+
+# 멀티 뱅크 BRAM - 1 / 2 / 3 / 4
+# 사용법: -tclargs -banks 4  (또는 source 전에 set bram_banks 4)
+# 2 이상이면 기존 BRAM(HPM0_LPD, 0x80000000)은 그대로 두고 8KB 뱅크 N개를
+# HPM0_FPD / HPM1_FPD 뒤에 번갈아 추가합니다 (뱅크 i → HPM(i % 2)_FPD).
+#   뱅크 0, 2: 0xA0000000, 0xA0002000 (HPM0_FPD)
+#   뱅크 1, 3: 0xB0000000, 0xB0002000 (HPM1_FPD)
+# 앱의 BRAM_BANK_COUNT 심볼을 같은 값으로 맞춥니다.
+get_opt banks bram_banks 1
+if {$bram_banks ni {1 2 3 4}} {
+    puts "ERROR: bram_banks must be 1..4 (got '$bram_banks')"
+    return -code error "invalid bram_banks"
+}
+set bank_ports [expr {$bram_banks > 1 ? 2 : 0}]
+
+# AXI-Stream ingest (BRAM 포트 B) - 0 / 1
+# 사용법: -tclargs -stream 1  (또는 source 전에 set bram_stream 1)
+# src/의 stream_ingest(패턴 발생기 + 프레임 링 writer)를 RTL 모듈로 추가하고
+# BRAM 포트 B에 연결합니다. 제어/카운터 레지스터는 0x80210000 (AXI-Lite).
+# writer가 32bit 폭으로 쓰므로 ECC 빌드(40bit)와는 함께 쓸 수 없습니다.
+get_opt stream bram_stream 0
+if {$bram_stream ni {0 1}} {
+    puts "ERROR: bram_stream must be 0 or 1 (got '$bram_stream')"
+    return -code error "invalid bram_stream"
+}
+if {$bram_stream && $bram_ecc} {
+    puts "ERROR: -stream 1 cannot be combined with -ecc 1 (port B writes 32-bit words)"
+    return -code error "invalid bram_stream"
+}
+set stream_mi [format "M%02d" [expr {1 + $bram_ecc}]]
+
+# PL 벡터 커널 (HLS bram_vec, BRAM 포트 B) - 0 / 1
+# 사용법: -tclargs -kernel 1  (또는 source 전에 set bram_kernel 1)
+# 먼저 hls/ 에서 vitis_hls -f run_hls.tcl 로 IP를 export 해야 합니다.
+# 제어 레지스터는 0x80220000 (s_axi_control). 포트 B를 쓰므로 -stream과,
+# 32bit 커널이므로 -ecc와 함께 쓸 수 없습니다.
+get_opt kernel bram_kernel 0
+if {$bram_kernel ni {0 1}} {
+    puts "ERROR: bram_kernel must be 0 or 1 (got '$bram_kernel')"
+    return -code error "invalid bram_kernel"
+}
+if {$bram_kernel && ($bram_stream || $bram_ecc)} {
+    puts "ERROR: -kernel 1 cannot be combined with -stream 1 or -ecc 1 (BRAM port B / 32-bit)"
+    return -code error "invalid bram_kernel"
+}
+set kernel_mi [format "M%02d" [expr {1 + $bram_ecc + $bram_stream}]]
+set kernel_ip_repo [file normalize $project_dir/../hls/bram_vec_prj/solution1/impl/ip]
+if {$bram_kernel && ![file exists $kernel_ip_repo]} {
+    puts "ERROR: HLS IP not found at $kernel_ip_repo"
+    puts "       Run 'vitis_hls -f run_hls.tcl' in hls/ first."
+    return -code error "missing bram_vec IP"
+}
+
+# 200 MHz 이상에서는 BRAM 출력 레지스터를 켜서 clock-to-out 경로를 끊음
+# (읽기 레이턴시 +1 사이클, BRAM Controller READ_LATENCY도 함께 맞춤)
+set bram_out_reg   [expr {$pl_clk_mhz >= 200 ? "true" : "false"}]
+set bram_read_lat  [expr {$pl_clk_mhz >= 200 ? 2 : 1}]
+set ila_pipe_stage [expr {$pl_clk_mhz >= 250 ? 1 : 0}]
+
 #------------------------------------------------------------------------------
 # 1. 프로젝트 생성
 #------------------------------------------------------------------------------
@@ -31,6 +129,18 @@ create_project $project_name $project_dir/$project_name -part $part_number
 # Board 설정 (KV260)
 set_property board_part xilinx.com:kv260_som:part0:1.4 [current_project]
 
+# Stream ingest RTL (블록 디자인에서 module reference로 사용)
+if {$bram_stream} {
+    add_files -norecurse [glob $project_dir/src/*.v]
+    update_compile_order -fileset sources_1
+}
+
+# HLS 커널 IP 저장소
+if {$bram_kernel} {
+    set_property ip_repo_paths $kernel_ip_repo [current_project]
+    update_ip_catalog
+}
+
 #------------------------------------------------------------------------------
 # 2. Block Design 생성
 #------------------------------------------------------------------------------
@@ -51,15 +161,26 @@ apply_bd_automation -rule xilinx.com:bd_rule:zynq_ultra_ps_e -config {
     apply_board_preset "1"
 } [get_bd_cells zynq_ultra_ps_e_0]
 
-# PS 설정 - AXI HPM0 LPD 활성화 (Low Power Domain)
+# PS 설정 - AXI HPM0 LPD 활성화 (Low Power Domain), TTC0 (SYSMON 샘플러 타이머)
 set_property -dict [list \
     CONFIG.PSU__USE__M_AXI_GP0 {0} \
     CONFIG.PSU__USE__M_AXI_GP1 {0} \
     CONFIG.PSU__USE__M_AXI_GP2 {1} \
+    CONFIG.PSU__TTC0__PERIPHERAL__ENABLE {1} \
     CONFIG.PSU__FPGA_PL0_ENABLE {1} \
-    CONFIG.PSU__CRL_APB__PL0_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__PL0_REF_CTRL__FREQMHZ $pl_clk_mhz \
 ] [get_bd_cells zynq_ultra_ps_e_0]
 
+# 멀티 뱅크 빌드: HPM0_FPD / HPM1_FPD 활성화 (BRAM 폭에 맞춰 32bit)
+if {$bank_ports} {
+    set_property -dict [list \
+        CONFIG.PSU__USE__M_AXI_GP0 {1} \
+        CONFIG.PSU__USE__M_AXI_GP1 {1} \
+        CONFIG.PSU__MAXIGP0__DATA_WIDTH {32} \
+        CONFIG.PSU__MAXIGP1__DATA_WIDTH {32} \
+    ] [get_bd_cells zynq_ultra_ps_e_0]
+}
+
 #------------------------------------------------------------------------------
 # 4. AXI BRAM Controller 추가
 #------------------------------------------------------------------------------
@@ -76,8 +197,18 @@ set_property -dict [list \
     CONFIG.SINGLE_PORT_BRAM {1} \
     CONFIG.DATA_WIDTH {32} \
     CONFIG.ECC_TYPE {0} \
+    CONFIG.READ_LATENCY $bram_read_lat \
 ] [get_bd_cells axi_bram_ctrl_0]
 
+# ECC 빌드: Hamming + fault injection, 리셋 후 ECC 검사 ON
+if {$bram_ecc} {
+    set_property -dict [list \
+        CONFIG.ECC_TYPE {Hamming} \
+        CONFIG.FAULT_INJECT {1} \
+        CONFIG.ECC_ONOFF_RESET_VALUE {1} \
+    ] [get_bd_cells axi_bram_ctrl_0]
+}
+
 #------------------------------------------------------------------------------
 # 5. Block Memory Generator 추가
 #------------------------------------------------------------------------------
@@ -92,13 +223,13 @@ set_property -dict [list \
     CONFIG.Enable_32bit_Address {false} \
     CONFIG.Use_Byte_Write_Enable {true} \
     CONFIG.Byte_Size {8} \
-    CONFIG.Write_Width_A {32} \
-    CONFIG.Read_Width_A {32} \
+    CONFIG.Write_Width_A $bram_width \
+    CONFIG.Read_Width_A $bram_width \
     CONFIG.Write_Depth_A {2048} \
     CONFIG.Read_Depth_A {2048} \
-    CONFIG.Write_Width_B {32} \
-    CONFIG.Read_Width_B {32} \
-    CONFIG.Register_PortA_Output_of_Memory_Primitives {false} \
+    CONFIG.Write_Width_B $bram_width \
+    CONFIG.Read_Width_B $bram_width \
+    CONFIG.Register_PortA_Output_of_Memory_Primitives $bram_out_reg \
     CONFIG.Register_PortB_Output_of_Memory_Primitives {false} \
 ] [get_bd_cells blk_mem_gen_0]
 
@@ -110,9 +241,9 @@ puts "Adding AXI Interconnect..."
 # AXI Interconnect IP 추가
 create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 axi_interconnect_0
 
-# 1 Master, 1 Slave 설정
+# 1 Master, 1 Slave 설정 (ECC / stream ingest / 벡터 커널 레지스터용 MI 추가)
 set_property -dict [list \
-    CONFIG.NUM_MI {1} \
+    CONFIG.NUM_MI [expr {1 + $bram_ecc + $bram_stream + $bram_kernel}] \
     CONFIG.NUM_SI {1} \
 ] [get_bd_cells axi_interconnect_0]
 
@@ -140,7 +271,7 @@ set_property -dict [list \
     CONFIG.C_SLOT_0_AXI_DATA_WIDTH {32} \
     CONFIG.C_SLOT_0_AXI_ADDR_WIDTH {32} \
     CONFIG.C_DATA_DEPTH {4096} \
-    CONFIG.C_INPUT_PIPE_STAGES {0} \
+    CONFIG.C_INPUT_PIPE_STAGES $ila_pipe_stage \
 ] [get_bd_cells system_ila_0]
 
 #------------------------------------------------------------------------------
@@ -189,6 +320,116 @@ connect_bd_intf_net [get_bd_intf_pins axi_interconnect_0/M00_AXI] \
 connect_bd_intf_net [get_bd_intf_pins axi_bram_ctrl_0/BRAM_PORTA] \
     [get_bd_intf_pins blk_mem_gen_0/BRAM_PORTA]
 
+# ECC 레지스터 인터페이스 (AXI4-Lite)
+if {$bram_ecc} {
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins axi_interconnect_0/M01_ACLK]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins axi_interconnect_0/M01_ARESETN]
+    connect_bd_intf_net [get_bd_intf_pins axi_interconnect_0/M01_AXI] \
+        [get_bd_intf_pins axi_bram_ctrl_0/S_AXI_CTRL]
+}
+
+# Stream ingest: AXI-Lite 레지스터 + 발생기 M_AXIS -> writer S_AXIS -> BRAM 포트 B
+if {$bram_stream} {
+    create_bd_cell -type module -reference stream_ingest stream_ingest_0
+
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins axi_interconnect_0/${stream_mi}_ACLK]
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins stream_ingest_0/s_axi_aclk]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins axi_interconnect_0/${stream_mi}_ARESETN]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins stream_ingest_0/s_axi_aresetn]
+    connect_bd_intf_net [get_bd_intf_pins axi_interconnect_0/${stream_mi}_AXI] \
+        [get_bd_intf_pins stream_ingest_0/S_AXI]
+    connect_bd_intf_net [get_bd_intf_pins stream_ingest_0/M_AXIS] \
+        [get_bd_intf_pins stream_ingest_0/S_AXIS]
+    connect_bd_intf_net [get_bd_intf_pins stream_ingest_0/BRAM_PORTB] \
+        [get_bd_intf_pins blk_mem_gen_0/BRAM_PORTB]
+}
+
+# 벡터 커널: s_axi_control (시작/완료 + 인자) + mem_PORTA -> BRAM 포트 B
+if {$bram_kernel} {
+    create_bd_cell -type ip -vlnv xilinx.com:hls:bram_vec:1.0 bram_vec_0
+
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins axi_interconnect_0/${kernel_mi}_ACLK]
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins bram_vec_0/ap_clk]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins axi_interconnect_0/${kernel_mi}_ARESETN]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins bram_vec_0/ap_rst_n]
+    connect_bd_intf_net [get_bd_intf_pins axi_interconnect_0/${kernel_mi}_AXI] \
+        [get_bd_intf_pins bram_vec_0/s_axi_control]
+    connect_bd_intf_net [get_bd_intf_pins bram_vec_0/mem_PORTA] \
+        [get_bd_intf_pins blk_mem_gen_0/BRAM_PORTB]
+}
+
+# 멀티 뱅크: HPMp_FPD -> axi_interconnect_hpm<p> -> axi_bram_ctrl_bank<i> -> blk_mem_gen_bank<i>
+# 포트마다 인터커넥트를 따로 두어 두 HPM 경로가 동시에 트랜잭션을 진행할 수 있게 함
+for {set p 0} {$p < $bank_ports} {incr p} {
+    set ic axi_interconnect_hpm$p
+    set port_banks [expr {($bram_banks + 1 - $p) / 2}]
+    create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 $ic
+    set_property -dict [list \
+        CONFIG.NUM_MI $port_banks \
+        CONFIG.NUM_SI {1} \
+    ] [get_bd_cells $ic]
+
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins zynq_ultra_ps_e_0/maxihpm${p}_fpd_aclk]
+    foreach pin {ACLK S00_ACLK} {
+        connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins $ic/$pin]
+    }
+    connect_bd_net [get_bd_pins proc_sys_reset_0/interconnect_aresetn] \
+        [get_bd_pins $ic/ARESETN]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins $ic/S00_ARESETN]
+    connect_bd_intf_net [get_bd_intf_pins zynq_ultra_ps_e_0/M_AXI_HPM${p}_FPD] \
+        [get_bd_intf_pins $ic/S00_AXI]
+}
+
+for {set b 0} {$b < $bram_banks && $bank_ports} {incr b} {
+    set ic axi_interconnect_hpm[expr {$b % 2}]
+    set mi [format "M%02d" [expr {$b / 2}]]
+
+    create_bd_cell -type ip -vlnv xilinx.com:ip:axi_bram_ctrl:4.1 axi_bram_ctrl_bank$b
+    set_property -dict [list \
+        CONFIG.SINGLE_PORT_BRAM {1} \
+        CONFIG.DATA_WIDTH {32} \
+        CONFIG.ECC_TYPE {0} \
+        CONFIG.READ_LATENCY $bram_read_lat \
+    ] [get_bd_cells axi_bram_ctrl_bank$b]
+
+    create_bd_cell -type ip -vlnv xilinx.com:ip:blk_mem_gen:8.4 blk_mem_gen_bank$b
+    set_property -dict [list \
+        CONFIG.Memory_Type {Single_Port_RAM} \
+        CONFIG.Enable_32bit_Address {false} \
+        CONFIG.Use_Byte_Write_Enable {true} \
+        CONFIG.Byte_Size {8} \
+        CONFIG.Write_Width_A {32} \
+        CONFIG.Read_Width_A {32} \
+        CONFIG.Write_Depth_A {2048} \
+        CONFIG.Read_Depth_A {2048} \
+        CONFIG.Register_PortA_Output_of_Memory_Primitives $bram_out_reg \
+    ] [get_bd_cells blk_mem_gen_bank$b]
+
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins $ic/${mi}_ACLK]
+    connect_bd_net [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] \
+        [get_bd_pins axi_bram_ctrl_bank$b/s_axi_aclk]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins $ic/${mi}_ARESETN]
+    connect_bd_net [get_bd_pins proc_sys_reset_0/peripheral_aresetn] \
+        [get_bd_pins axi_bram_ctrl_bank$b/s_axi_aresetn]
+    connect_bd_intf_net [get_bd_intf_pins $ic/${mi}_AXI] \
+        [get_bd_intf_pins axi_bram_ctrl_bank$b/S_AXI]
+    connect_bd_intf_net [get_bd_intf_pins axi_bram_ctrl_bank$b/BRAM_PORTA] \
+        [get_bd_intf_pins blk_mem_gen_bank$b/BRAM_PORTA]
+}
+
 # ILA를 BRAM Controller의 AXI 인터페이스에 연결 (모니터링)
 connect_bd_intf_net [get_bd_intf_pins axi_interconnect_0/M00_AXI] \
     [get_bd_intf_pins system_ila_0/SLOT_0_AXI]
@@ -204,6 +445,42 @@ assign_bd_address -target_address_space /zynq_ultra_ps_e_0/Data \
 set_property offset 0x80000000 [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_axi_bram_ctrl_0_Mem0}]
 set_property range 8K [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_axi_bram_ctrl_0_Mem0}]
 
+# 레지스터 창은 0x8020_0000 2MB 블록에 배치 (BRAM 블록 0x8000_0000은 앱의 Cached 측정 중
+# Normal WB로 매핑되므로 같은 블록에 레지스터를 두지 않음)
+# ECC 레지스터 (0x8020_0000, 4KB)
+if {$bram_ecc} {
+    assign_bd_address -target_address_space /zynq_ultra_ps_e_0/Data \
+        [get_bd_addr_segs axi_bram_ctrl_0/S_AXI_CTRL/Reg] -force
+    set_property offset 0x80200000 [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_axi_bram_ctrl_0_Reg}]
+    set_property range 4K [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_axi_bram_ctrl_0_Reg}]
+}
+
+# Stream ingest 레지스터 (0x8021_0000, 4KB)
+if {$bram_stream} {
+    assign_bd_address -target_address_space /zynq_ultra_ps_e_0/Data \
+        [get_bd_addr_segs stream_ingest_0/S_AXI/reg0] -force
+    set_property offset 0x80210000 [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_stream_ingest_0_reg0}]
+    set_property range 4K [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_stream_ingest_0_reg0}]
+}
+
+# 벡터 커널 레지스터 (0x8022_0000, 4KB)
+if {$bram_kernel} {
+    assign_bd_address -target_address_space /zynq_ultra_ps_e_0/Data \
+        [get_bd_addr_segs bram_vec_0/s_axi_control/Reg] -force
+    set_property offset 0x80220000 [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_bram_vec_0_Reg}]
+    set_property range 4K [get_bd_addr_segs {zynq_ultra_ps_e_0/Data/SEG_bram_vec_0_Reg}]
+}
+
+# 멀티 뱅크 (각 8KB, 포트 안에서 8KB 간격)
+for {set b 0} {$b < $bram_banks && $bank_ports} {incr b} {
+    set seg SEG_axi_bram_ctrl_bank${b}_Mem0
+    set base [expr {($b % 2 ? 0xB0000000 : 0xA0000000) + ($b / 2) * 0x2000}]
+    assign_bd_address -target_address_space /zynq_ultra_ps_e_0/Data \
+        [get_bd_addr_segs axi_bram_ctrl_bank$b/S_AXI/Mem0] -force
+    set_property offset [format "0x%08X" $base] [get_bd_addr_segs zynq_ultra_ps_e_0/Data/$seg]
+    set_property range 8K [get_bd_addr_segs zynq_ultra_ps_e_0/Data/$seg]
+}
+
 #------------------------------------------------------------------------------
 # 11. Block Design 검증 및 저장
 #------------------------------------------------------------------------------
@@ -267,5 +544,10 @@ puts "- Project Name: $project_name"
 puts "- Part: $part_number"
 puts "- BRAM Base Address: 0x80000000"
 puts "- BRAM Size: 8KB (2048 x 32-bit words)"
-puts "- Clock: 100 MHz (PL0)"
+puts "- Clock: $pl_clk_mhz MHz (PL0)"
+puts "- BRAM Output Register: $bram_out_reg (read latency $bram_read_lat)"
+puts "- BRAM ECC: [expr {$bram_ecc ? "Hamming SEC-DED, registers @ 0x80200000" : "off"}]"
+puts "- Stream Ingest: [expr {$bram_stream ? "port B writer, registers @ 0x80210000" : "off"}]"
+puts "- Vector Kernel: [expr {$bram_kernel ? "HLS bram_vec on port B, registers @ 0x80220000" : "off"}]"
+puts "- BRAM Banks: [expr {$bank_ports ? "$bram_banks x 8KB on HPM0/HPM1_FPD (0xA0000000 / 0xB0000000)" : "single (LPD only)"}]"
 puts "=============================================="
@@ -0,0 +1,109 @@
+#==============================================================================
+# KV260 BRAM Stream Ingest - RTL 테스트벤치 실행 스크립트
+#
+# tb_stream_ingest.v 를 iverilog / Verilator / Vivado xsim 중 찾은 시뮬레이터로
+# 컴파일·실행하고, 마지막 결과 줄로 종료 코드를 정합니다.
+#   0 = tb_stream_ingest: PASS, 1 = FAIL 또는 결과 줄 없음, 2 = 시뮬레이터 없음
+#
+# 사용법 (01.KRIA_BRAM_ILA/vivado 또는 어디서든):
+#   tclsh sim/run_tb.tcl [-sim auto|iverilog|verilator|xsim]
+#   vivado -mode batch -source sim/run_tb.tcl -tclargs -sim xsim
+#
+# 작업 파일은 sim/work/<시뮬레이터>/ 에 생성됩니다 (git 제외).
+#==============================================================================
+
+set sim_dir  [file dirname [file normalize [info script]]]
+set rtl_dir  [file join [file dirname $sim_dir] src]
+set top      "tb_stream_ingest"
+set sources  [list \
+    [file join $sim_dir tb_stream_ingest.v] \
+    [file join $rtl_dir stream_ingest.v] \
+    [file join $rtl_dir axis_pattern_gen.v] \
+    [file join $rtl_dir axis_bram_writer.v]]
+
+set sim "auto"
+set args [expr {[info exists argv] ? $argv : {}}]
+set arg_idx [lsearch -exact $args "-sim"]
+if {$arg_idx >= 0} {
+    set sim [lindex $args [expr {$arg_idx + 1}]]
+}
+if {$sim ni {auto iverilog verilator xsim}} {
+    puts "ERROR: -sim must be auto, iverilog, verilator or xsim (got '$sim')"
+    exit 2
+}
+
+#------------------------------------------------------------------------------
+# 시뮬레이터 선택 (auto: iverilog → verilator → xsim 순서)
+#------------------------------------------------------------------------------
+set tools {iverilog {iverilog vvp} verilator {verilator} xsim {xvlog xelab xsim}}
+
+proc have_tools {names} {
+    foreach n $names {
+        if {[auto_execok $n] eq ""} {
+            return 0
+        }
+    }
+    return 1
+}
+
+if {$sim eq "auto"} {
+    foreach {name names} $tools {
+        if {[have_tools $names]} {
+            set sim $name
+            break
+        }
+    }
+    if {$sim eq "auto"} {
+        puts "ERROR: no Verilog simulator found (iverilog+vvp, verilator, or Vivado xvlog/xelab/xsim)"
+        exit 2
+    }
+} elseif {![have_tools [dict get $tools $sim]]} {
+    puts "ERROR: $sim not found in PATH ([dict get $tools $sim])"
+    exit 2
+}
+
+set work [file join $sim_dir work $sim]
+file mkdir $work
+cd $work
+
+#------------------------------------------------------------------------------
+# 컴파일 + 실행 (출력은 그대로 보여 주고 결과 줄만 따로 확인)
+#------------------------------------------------------------------------------
+proc run {args} {
+    puts "> [join $args]"
+    set rc [catch {exec {*}[lreplace $args 0 0 {*}[auto_execok [lindex $args 0]]] 2>@1} out]
+    puts $out
+    if {$rc} {
+        puts "ERROR: [lindex $args 0] failed"
+        exit 1
+    }
+    return $out
+}
+
+puts "======================================"
+puts " $top ($sim)"
+puts "======================================"
+
+switch -- $sim {
+    iverilog {
+        run iverilog -g2005 -o $top {*}$sources
+        set out [run vvp -n $top]
+    }
+    verilator {
+        run verilator --binary --timing -Wno-fatal --top-module $top -Mdir obj_dir {*}$sources
+        set out [run [file join $work obj_dir V$top]]
+    }
+    xsim {
+        run xvlog {*}$sources
+        run xelab -debug off -s $top $top
+        set out [run xsim $top -R]
+    }
+}
+
+if {[regexp -line "^$top: PASS\\s*$" $out]} {
+    exit 0
+}
+if {![regexp -line "^$top: FAIL" $out]} {
+    puts "ERROR: no '$top: PASS/FAIL' line in the simulator output"
+}
+exit 1
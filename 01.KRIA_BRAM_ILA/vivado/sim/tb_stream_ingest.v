@@ -0,0 +1,322 @@
+`timescale 1ns / 1ps
+//==============================================================================
+// KV260 BRAM Stream Ingest - 테스트벤치 (iverilog / Verilator)
+//
+// stream_ingest의 M_AXIS → S_AXIS를 블록 디자인처럼 연결하고, 포트 B 쓰기를
+// 받는 2048 x 32 BRAM 모델과 AXI-Lite 읽기/쓰기 태스크로 검증합니다.
+//   1. stall 모드 + 느린 소비자: 프레임 내용/순서, drop 0, stall > 0, FILL_MAX
+//   2. drop 모드 + 소비 없음: 슬롯 수만큼만 쓰고 나머지 프레임은 버림
+//   3. RATE_DIV: 받은 beat 수 = 사이클 / (RATE_DIV + 1)
+//
+// 실행 (01.KRIA_BRAM_ILA/vivado 에서): tclsh sim/run_tb.tcl [-sim iverilog|verilator|xsim]
+// 또는 직접:
+//   iverilog -g2005 -o tb_stream_ingest sim/tb_stream_ingest.v src/stream_ingest.v \
+//       src/axis_pattern_gen.v src/axis_bram_writer.v && vvp tb_stream_ingest
+//   verilator --binary --timing -Wno-fatal --top-module tb_stream_ingest \
+//       sim/tb_stream_ingest.v src/stream_ingest.v src/axis_pattern_gen.v \
+//       src/axis_bram_writer.v && ./obj_dir/Vtb_stream_ingest
+//==============================================================================
+
+module tb_stream_ingest;
+
+    localparam FW    = 16;      // 프레임 워드
+    localparam SLOTS = 4;
+
+    localparam A_CTRL         = 6'h00;
+    localparam A_FRAME_WORDS  = 6'h08;
+    localparam A_SLOTS        = 6'h0C;
+    localparam A_RATE_DIV     = 6'h10;
+    localparam A_RELEASE      = 6'h18;
+    localparam A_PENDING      = 6'h1C;
+    localparam A_CYCLES       = 6'h20;
+    localparam A_BEATS        = 6'h24;
+    localparam A_FRAMES       = 6'h28;
+    localparam A_DROP_BEATS   = 6'h2C;
+    localparam A_DROP_FRAMES  = 6'h30;
+    localparam A_STALL_CYCLES = 6'h34;
+    localparam A_FILL_MAX     = 6'h38;
+    localparam A_ID           = 6'h3C;
+
+    reg clk = 1'b0;
+    reg rst_n = 1'b0;
+
+    always #5 clk = ~clk;       // 100 MHz
+
+    //--------------------------------------------------------------------------
+    // DUT
+    //--------------------------------------------------------------------------
+    reg  [5:0]  s_axi_awaddr = 6'd0;
+    reg         s_axi_awvalid = 1'b0;
+    wire        s_axi_awready;
+    reg  [31:0] s_axi_wdata = 32'd0;
+    reg         s_axi_wvalid = 1'b0;
+    wire        s_axi_wready;
+    wire [1:0]  s_axi_bresp;
+    wire        s_axi_bvalid;
+    reg         s_axi_bready = 1'b0;
+    reg  [5:0]  s_axi_araddr = 6'd0;
+    reg         s_axi_arvalid = 1'b0;
+    wire        s_axi_arready;
+    wire [31:0] s_axi_rdata;
+    wire [1:0]  s_axi_rresp;
+    wire        s_axi_rvalid;
+    reg         s_axi_rready = 1'b0;
+
+    wire [31:0] axis_tdata;
+    wire        axis_tlast;
+    wire        axis_tvalid;
+    wire        axis_tready;
+
+    wire        bram_clk_b;
+    wire        bram_rst_b;
+    wire        bram_en_b;
+    wire [3:0]  bram_we_b;
+    wire [31:0] bram_addr_b;
+    wire [31:0] bram_wrdata_b;
+
+    stream_ingest dut (
+        .s_axi_aclk     (clk),
+        .s_axi_aresetn  (rst_n),
+        .s_axi_awaddr   (s_axi_awaddr),
+        .s_axi_awprot   (3'd0),
+        .s_axi_awvalid  (s_axi_awvalid),
+        .s_axi_awready  (s_axi_awready),
+        .s_axi_wdata    (s_axi_wdata),
+        .s_axi_wstrb    (4'hF),
+        .s_axi_wvalid   (s_axi_wvalid),
+        .s_axi_wready   (s_axi_wready),
+        .s_axi_bresp    (s_axi_bresp),
+        .s_axi_bvalid   (s_axi_bvalid),
+        .s_axi_bready   (s_axi_bready),
+        .s_axi_araddr   (s_axi_araddr),
+        .s_axi_arprot   (3'd0),
+        .s_axi_arvalid  (s_axi_arvalid),
+        .s_axi_arready  (s_axi_arready),
+        .s_axi_rdata    (s_axi_rdata),
+        .s_axi_rresp    (s_axi_rresp),
+        .s_axi_rvalid   (s_axi_rvalid),
+        .s_axi_rready   (s_axi_rready),
+        .m_axis_tdata   (axis_tdata),
+        .m_axis_tlast   (axis_tlast),
+        .m_axis_tvalid  (axis_tvalid),
+        .m_axis_tready  (axis_tready),
+        .s_axis_tdata   (axis_tdata),
+        .s_axis_tlast   (axis_tlast),
+        .s_axis_tvalid  (axis_tvalid),
+        .s_axis_tready  (axis_tready),
+        .bram_clk_b     (bram_clk_b),
+        .bram_rst_b     (bram_rst_b),
+        .bram_en_b      (bram_en_b),
+        .bram_we_b      (bram_we_b),
+        .bram_addr_b    (bram_addr_b),
+        .bram_wrdata_b  (bram_wrdata_b),
+        .bram_rddata_b  (32'd0)
+    );
+
+    //--------------------------------------------------------------------------
+    // BRAM 모델 (포트 B 쓰기, 바이트 주소)
+    // 초기화하지 않습니다: 블로킹/논블로킹 쓰기를 섞으면 Verilator가
+    // BLKANDNBLK 오류를 내고, 안 쓴 워드는 X라서 check_slot의 !== 에 걸립니다.
+    //--------------------------------------------------------------------------
+    reg [31:0] mem [0:2047];
+    integer i;
+
+    always @(posedge bram_clk_b) begin
+        if (bram_en_b && bram_we_b == 4'hF)
+            mem[bram_addr_b[12:2]] <= bram_wrdata_b;
+    end
+
+    //--------------------------------------------------------------------------
+    // AXI-Lite 태스크 (negedge에서 구동, posedge에서 핸드셰이크)
+    //--------------------------------------------------------------------------
+    task axi_write;
+        input [5:0]  addr;
+        input [31:0] data;
+        begin
+            @(negedge clk);
+            s_axi_awaddr  = addr;
+            s_axi_wdata   = data;
+            s_axi_awvalid = 1'b1;
+            s_axi_wvalid  = 1'b1;
+            s_axi_bready  = 1'b1;
+            #1;
+            while (!s_axi_awready) begin
+                @(negedge clk);
+                #1;
+            end
+            @(negedge clk);
+            s_axi_awvalid = 1'b0;
+            s_axi_wvalid  = 1'b0;
+            #1;
+            while (!s_axi_bvalid) begin
+                @(negedge clk);
+                #1;
+            end
+            @(negedge clk);
+            s_axi_bready = 1'b0;
+        end
+    endtask
+
+    task axi_read;
+        input  [5:0]  addr;
+        output [31:0] data;
+        begin
+            @(negedge clk);
+            s_axi_araddr  = addr;
+            s_axi_arvalid = 1'b1;
+            s_axi_rready  = 1'b1;
+            #1;
+            while (!s_axi_arready) begin
+                @(negedge clk);
+                #1;
+            end
+            @(negedge clk);
+            s_axi_arvalid = 1'b0;
+            #1;
+            while (!s_axi_rvalid) begin
+                @(negedge clk);
+                #1;
+            end
+            data = s_axi_rdata;
+            @(negedge clk);
+            s_axi_rready = 1'b0;
+        end
+    endtask
+
+    //--------------------------------------------------------------------------
+    // 검사
+    //--------------------------------------------------------------------------
+    integer errors = 0;
+
+    task check;
+        input [8*24-1:0] name;
+        input            ok;
+        input [31:0]     value;
+        begin
+            if (!ok) begin
+                errors = errors + 1;
+                $display("  FAIL %0s (value %0d)", name, value);
+            end
+        end
+    endtask
+
+    // 슬롯의 프레임 내용 = {프레임 번호, beat 번호}
+    task check_slot;
+        input [15:0] slot;
+        input [15:0] frame;
+        integer k, bad;
+        begin
+            bad = 0;
+            for (k = 0; k < FW; k = k + 1) begin
+                if (mem[slot * FW + k] !== {frame, k[15:0]})
+                    bad = bad + 1;
+            end
+            if (bad != 0) begin
+                errors = errors + 1;
+                $display("  FAIL slot %0d frame %0d: %0d bad words", slot, frame, bad);
+            end
+        end
+    endtask
+
+    reg [31:0] v, pending, cycles, beats, frames, drop_beats, drop_frames, stall, fill_max;
+    integer consumed, slot;
+
+    task read_counters;
+        begin
+            axi_read(A_CYCLES, cycles);
+            axi_read(A_BEATS, beats);
+            axi_read(A_FRAMES, frames);
+            axi_read(A_DROP_BEATS, drop_beats);
+            axi_read(A_DROP_FRAMES, drop_frames);
+            axi_read(A_STALL_CYCLES, stall);
+            axi_read(A_FILL_MAX, fill_max);
+            $display("  cycles %0d beats %0d frames %0d drop %0d/%0d stall %0d fill_max %0d",
+                     cycles, beats, frames, drop_beats, drop_frames, stall, fill_max);
+        end
+    endtask
+
+    initial begin
+        repeat (5) @(posedge clk);
+        rst_n = 1'b1;
+
+        axi_read(A_ID, v);
+        check("ID", v == 32'h5354524D, v);
+
+        axi_write(A_FRAME_WORDS, FW);
+        axi_write(A_SLOTS, SLOTS);
+
+        //----------------------------------------------------------------------
+        // 1. stall 모드, 프레임당 200 사이클 걸리는 소비자
+        //----------------------------------------------------------------------
+        $display("[1] stall mode, slow consumer");
+        axi_write(A_RATE_DIV, 0);
+        axi_write(A_CTRL, 32'h80000000);
+        axi_write(A_CTRL, 32'h00000001);
+
+        consumed = 0;
+        slot = 0;
+        while (consumed < 20) begin
+            axi_read(A_PENDING, pending);
+            if (pending != 0) begin
+                check_slot(slot, consumed);
+                repeat (200) @(posedge clk);
+                axi_write(A_RELEASE, 1);
+                consumed = consumed + 1;
+                slot = (slot + 1) % SLOTS;
+            end
+        end
+        axi_write(A_CTRL, 0);
+        read_counters;
+        check("no dropped beats", drop_beats == 0, drop_beats);
+        check("no dropped frames", drop_frames == 0, drop_frames);
+        check("frames >= consumed", frames >= 20, frames);
+        check("beats = frames * FW", beats >= frames * FW && beats < (frames + 1) * FW, beats);
+        check("stalled", stall > 0, stall);
+        check("fill_max = slots", fill_max == SLOTS, fill_max);
+
+        //----------------------------------------------------------------------
+        // 2. drop 모드, 소비 없음
+        //----------------------------------------------------------------------
+        $display("[2] drop mode, no consumer");
+        axi_write(A_CTRL, 32'h80000000);
+        axi_write(A_CTRL, 32'h00000003);
+        repeat (2000) @(posedge clk);
+        axi_write(A_CTRL, 0);
+        read_counters;
+        check("frames = slots", frames == SLOTS, frames);
+        check("beats = slots * FW", beats == SLOTS * FW, beats);
+        check("dropped frames", drop_frames > 100, drop_frames);
+        check("dropped beats", drop_beats >= drop_frames * FW &&
+                               drop_beats < (drop_frames + 1) * FW, drop_beats);
+        check("no stall", stall == 0, stall);
+        for (i = 0; i < SLOTS; i = i + 1)
+            check_slot(i, i);
+
+        //----------------------------------------------------------------------
+        // 3. RATE_DIV = 3 → 4 사이클마다 beat 1개 (drop 모드라 backpressure 없음)
+        //----------------------------------------------------------------------
+        $display("[3] rate_div 3");
+        axi_write(A_RATE_DIV, 3);
+        axi_write(A_CTRL, 32'h80000000);
+        axi_write(A_CTRL, 32'h00000003);
+        repeat (1000) @(posedge clk);
+        axi_write(A_CTRL, 0);
+        read_counters;
+        v = beats + drop_beats;
+        check("beats = cycles / 4", v + 2 >= cycles / 4 && v <= cycles / 4 + 2, v);
+
+        if (errors == 0)
+            $display("tb_stream_ingest: PASS");
+        else
+            $display("tb_stream_ingest: FAIL (%0d errors)", errors);
+        $finish;
+    end
+
+    // 타임아웃
+    initial begin
+        #2000000;
+        $display("tb_stream_ingest: FAIL (timeout)");
+        $finish;
+    end
+
+endmodule
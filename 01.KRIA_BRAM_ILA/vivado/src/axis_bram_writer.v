@@ -0,0 +1,138 @@
+`timescale 1ns / 1ps
+//==============================================================================
+// KV260 BRAM Stream Ingest - AXI-Stream → BRAM 포트 B 프레임 링 writer
+//
+// BRAM을 frame_words 워드짜리 슬롯 slots개의 링으로 나누고, 프레임(TLAST까지)
+// 하나를 슬롯 하나에 씁니다. 다 쓴 프레임은 pending이 되고, CPU가 읽은 뒤
+// release로 반납할 때까지 슬롯을 다시 쓰지 않습니다.
+//
+// 프레임 단위 backpressure (새 프레임 첫 beat에서만 판단):
+//   빈 슬롯 있음          → 프레임 전체를 씀 (TREADY = 1)
+//   없음, drop_on_full = 0 → TREADY = 0 으로 대기 (stall 사이클)
+//   없음, drop_on_full = 1 → 프레임 전체를 받아서 버림 (dropped beat / frame)
+// 프레임이 frame_words보다 길면 넘친 beat는 쓰지 않고 dropped beat로 셉니다.
+// 슬롯 배치(slots x frame_words <= BRAM 워드 수)는 소프트웨어가 보장합니다.
+//==============================================================================
+
+module axis_bram_writer (
+    input  wire        clk,
+    input  wire        rst_n,
+    input  wire        enable,          // 0 = 링 리셋 (슬롯 0, pending 0)
+    input  wire        drop_on_full,
+    input  wire [15:0] frame_words,     // 슬롯 크기 (워드, 0은 1로 취급)
+    input  wire [15:0] slots,           // 슬롯 수 (0은 1로 취급)
+    input  wire        release_valid,   // CPU가 읽은 프레임 반납
+    input  wire [15:0] release_count,
+
+    input  wire [31:0] s_axis_tdata,
+    input  wire        s_axis_tlast,
+    input  wire        s_axis_tvalid,
+    output wire        s_axis_tready,
+
+    output reg         bram_en,
+    output reg  [3:0]  bram_we,
+    output reg  [31:0] bram_addr,       // 바이트 주소 (BRAM Controller 모드)
+    output reg  [31:0] bram_din,
+
+    output reg  [15:0] wr_slot,         // 쓰고 있는 / 다음에 쓸 슬롯
+    output reg  [15:0] pending,         // 반납되지 않은 프레임 수
+    output wire        in_frame,
+
+    // 이벤트 (1 사이클 펄스, stream_ingest의 카운터 입력)
+    output reg         ev_beat,
+    output reg         ev_frame,
+    output reg         ev_drop_beat,
+    output reg         ev_drop_frame,
+    output reg         ev_stall
+);
+
+    localparam S_IDLE  = 2'd0;      // 프레임 시작 대기
+    localparam S_WRITE = 2'd1;
+    localparam S_DROP  = 2'd2;
+
+    reg [1:0]  state;
+    reg [15:0] beat;                // 프레임 내 beat 번호
+    reg [15:0] slot_base;           // 현재 슬롯 시작 워드
+
+    wire [15:0] fw    = (frame_words == 16'd0) ? 16'd1 : frame_words;
+    wire [15:0] nslot = (slots == 16'd0) ? 16'd1 : slots;
+    wire        room  = (pending < nslot);
+
+    assign s_axis_tready = enable && (state != S_IDLE || room || drop_on_full);
+    assign in_frame      = (state != S_IDLE);
+
+    wire hs         = s_axis_tvalid && s_axis_tready;
+    wire accept     = (state == S_WRITE) || (state == S_IDLE && room);
+    wire write_beat = hs && accept && (beat < fw);
+    wire drop_beat  = hs && !write_beat;
+    wire frame_done = hs && s_axis_tlast && accept;
+
+    // 반납 수는 (완료 포함) pending을 넘지 않게 제한
+    wire [15:0] pend_next = pending + (frame_done ? 16'd1 : 16'd0);
+    wire [15:0] rel       = !release_valid ? 16'd0 :
+                            (release_count > pend_next) ? pend_next : release_count;
+
+    wire [15:0] word = slot_base + beat;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state         <= S_IDLE;
+            beat          <= 16'd0;
+            slot_base     <= 16'd0;
+            wr_slot       <= 16'd0;
+            pending       <= 16'd0;
+            bram_en       <= 1'b0;
+            bram_we       <= 4'h0;
+            bram_addr     <= 32'd0;
+            bram_din      <= 32'd0;
+            ev_beat       <= 1'b0;
+            ev_frame      <= 1'b0;
+            ev_drop_beat  <= 1'b0;
+            ev_drop_frame <= 1'b0;
+            ev_stall      <= 1'b0;
+        end else begin
+            // BRAM 쓰기 (1 사이클 레지스터)
+            bram_en   <= write_beat;
+            bram_we   <= write_beat ? 4'hF : 4'h0;
+            bram_addr <= {14'd0, word, 2'b00};
+            bram_din  <= s_axis_tdata;
+
+            ev_beat       <= write_beat;
+            ev_frame      <= frame_done;
+            ev_drop_beat  <= drop_beat;
+            ev_drop_frame <= hs && s_axis_tlast && !accept;
+            ev_stall      <= enable && s_axis_tvalid && !s_axis_tready;
+
+            if (!enable) begin
+                state     <= S_IDLE;
+                beat      <= 16'd0;
+                slot_base <= 16'd0;
+                wr_slot   <= 16'd0;
+                pending   <= 16'd0;
+            end else begin
+                if (hs) begin
+                    if (s_axis_tlast) begin
+                        state <= S_IDLE;
+                        beat  <= 16'd0;
+                        if (accept) begin
+                            // 다음 슬롯
+                            if (wr_slot + 16'd1 >= nslot) begin
+                                wr_slot   <= 16'd0;
+                                slot_base <= 16'd0;
+                            end else begin
+                                wr_slot   <= wr_slot + 16'd1;
+                                slot_base <= slot_base + fw;
+                            end
+                        end
+                    end else begin
+                        beat <= beat + 16'd1;
+                        if (state == S_IDLE)
+                            state <= accept ? S_WRITE : S_DROP;
+                    end
+                end
+                pending <= pend_next - rel;
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,68 @@
+`timescale 1ns / 1ps
+//==============================================================================
+// KV260 BRAM Stream Ingest - AXI-Stream 테스트 패턴 발생기
+//
+// 프레임 단위 32비트 스트림 (TLAST = 프레임 마지막 beat)
+//   TDATA = {프레임 번호[15:0], 프레임 내 beat 번호[15:0]}
+// rate_div = N 이면 최대 N+1 사이클마다 beat 1개 (0 = 매 사이클)
+// AXI-Stream 규칙대로 TVALID를 올린 뒤에는 TREADY까지 값을 유지하므로
+// 수신 측 backpressure로 beat를 잃지 않습니다 (버리는 것은 writer의 정책).
+//==============================================================================
+
+module axis_pattern_gen (
+    input  wire        clk,
+    input  wire        rst_n,
+    input  wire        enable,          // 0 = 정지 + 프레임/beat 번호 리셋
+    input  wire [15:0] frame_words,     // 프레임 길이 (beat, 0은 1로 취급)
+    input  wire [15:0] rate_div,
+
+    output reg  [31:0] m_axis_tdata,
+    output reg         m_axis_tlast,
+    output reg         m_axis_tvalid,
+    input  wire        m_axis_tready
+);
+
+    //--------------------------------------------------------------------------
+    // 다음에 출력 레지스터로 올릴 beat
+    //--------------------------------------------------------------------------
+    reg [15:0] frame_no;
+    reg [15:0] beat_no;
+    reg [15:0] rate_cnt;
+
+    wire [15:0] last_beat = (frame_words == 16'd0) ? 16'd0 : frame_words - 16'd1;
+    wire        handshake = m_axis_tvalid && m_axis_tready;
+    wire        load      = (!m_axis_tvalid || handshake) && (rate_cnt == 16'd0);
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            frame_no      <= 16'd0;
+            beat_no       <= 16'd0;
+            rate_cnt      <= 16'd0;
+            m_axis_tdata  <= 32'd0;
+            m_axis_tlast  <= 1'b0;
+            m_axis_tvalid <= 1'b0;
+        end else if (!enable) begin
+            frame_no      <= 16'd0;
+            beat_no       <= 16'd0;
+            rate_cnt      <= 16'd0;
+            m_axis_tvalid <= 1'b0;
+        end else if (load) begin
+            m_axis_tdata  <= {frame_no, beat_no};
+            m_axis_tlast  <= (beat_no == last_beat);
+            m_axis_tvalid <= 1'b1;
+            rate_cnt      <= rate_div;
+            if (beat_no == last_beat) begin
+                beat_no  <= 16'd0;
+                frame_no <= frame_no + 16'd1;
+            end else begin
+                beat_no <= beat_no + 16'd1;
+            end
+        end else begin
+            if (handshake)
+                m_axis_tvalid <= 1'b0;
+            if (rate_cnt != 16'd0)
+                rate_cnt <= rate_cnt - 16'd1;
+        end
+    end
+
+endmodule
@@ -0,0 +1,306 @@
+`timescale 1ns / 1ps
+//==============================================================================
+// KV260 BRAM Stream Ingest - AXI-Lite 제어 / 카운터 + 패턴 발생기 + writer
+//
+// M_AXIS(패턴 발생기 출력)와 S_AXIS(writer 입력)는 블록 디자인에서 연결합니다.
+// 실제 스트림 소스로 바꿀 때는 S_AXIS만 다른 마스터에 연결하면 됩니다.
+//
+// 레지스터 (AXI-Lite, 0x80210000):
+//   0x00 CTRL         [0] enable  [1] drop_on_full  [31] 카운터 클리어 (W1, 자동 0)
+//   0x04 STATUS       [0] enable  [1] writer 프레임 진행 중
+//   0x08 FRAME_WORDS  프레임 길이 = 슬롯 크기 (워드)
+//   0x0C SLOTS        링 슬롯 수
+//   0x10 RATE_DIV     발생기 beat 간격 - 1 (0 = 매 사이클)
+//   0x14 WR_SLOT      writer가 쓰는 / 다음에 쓸 슬롯 (RO)
+//   0x18 RELEASE      읽은 프레임 수 반납 (WO)
+//   0x1C PENDING      반납되지 않은 프레임 수 (RO, 마지막 워드가 BRAM에 써진 뒤 증가)
+//   0x20 CYCLES       enable 동안의 PL 클럭 사이클
+//   0x24 BEATS        BRAM에 쓴 beat
+//   0x28 FRAMES       BRAM에 쓴 프레임
+//   0x2C DROP_BEATS   버린 beat (슬롯 없음 + 프레임 길이 초과)
+//   0x30 DROP_FRAMES  슬롯이 없어 버린 프레임
+//   0x34 STALL_CYCLES TVALID && !TREADY 사이클
+//   0x38 FILL_MAX     PENDING 최대값
+//   0x3C ID           0x5354524D ("STRM")
+// FRAME_WORDS / SLOTS / RATE_DIV는 enable = 0 일 때 바꿉니다.
+//==============================================================================
+
+module stream_ingest #(
+    parameter C_S_AXI_ADDR_WIDTH = 6
+)(
+    (* X_INTERFACE_INFO = "xilinx.com:signal:clock:1.0 s_axi_aclk CLK" *)
+    (* X_INTERFACE_PARAMETER = "ASSOCIATED_BUSIF S_AXI:M_AXIS:S_AXIS, ASSOCIATED_RESET s_axi_aresetn" *)
+    input  wire        s_axi_aclk,
+    input  wire        s_axi_aresetn,
+
+    // AXI4-Lite slave
+    input  wire [C_S_AXI_ADDR_WIDTH-1:0] s_axi_awaddr,
+    input  wire [2:0]  s_axi_awprot,
+    input  wire        s_axi_awvalid,
+    output wire        s_axi_awready,
+    input  wire [31:0] s_axi_wdata,
+    input  wire [3:0]  s_axi_wstrb,
+    input  wire        s_axi_wvalid,
+    output wire        s_axi_wready,
+    output wire [1:0]  s_axi_bresp,
+    output reg         s_axi_bvalid,
+    input  wire        s_axi_bready,
+    input  wire [C_S_AXI_ADDR_WIDTH-1:0] s_axi_araddr,
+    input  wire [2:0]  s_axi_arprot,
+    input  wire        s_axi_arvalid,
+    output wire        s_axi_arready,
+    output reg  [31:0] s_axi_rdata,
+    output wire [1:0]  s_axi_rresp,
+    output reg         s_axi_rvalid,
+    input  wire        s_axi_rready,
+
+    // 패턴 발생기 출력
+    output wire [31:0] m_axis_tdata,
+    output wire        m_axis_tlast,
+    output wire        m_axis_tvalid,
+    input  wire        m_axis_tready,
+
+    // writer 입력
+    input  wire [31:0] s_axis_tdata,
+    input  wire        s_axis_tlast,
+    input  wire        s_axis_tvalid,
+    output wire        s_axis_tready,
+
+    // BRAM 포트 B (쓰기 전용)
+    (* X_INTERFACE_PARAMETER = "MASTER_TYPE BRAM_CTRL, MEM_SIZE 8192, MEM_WIDTH 32, MEM_ECC NONE, READ_WRITE_MODE WRITE_ONLY" *)
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB CLK" *)
+    output wire        bram_clk_b,
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB RST" *)
+    output wire        bram_rst_b,
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB EN" *)
+    output wire        bram_en_b,
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB WE" *)
+    output wire [3:0]  bram_we_b,
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB ADDR" *)
+    output wire [31:0] bram_addr_b,
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB DIN" *)
+    output wire [31:0] bram_wrdata_b,
+    (* X_INTERFACE_INFO = "xilinx.com:interface:bram:1.0 BRAM_PORTB DOUT" *)
+    input  wire [31:0] bram_rddata_b
+);
+
+    localparam [31:0] INGEST_ID = 32'h5354524D;
+
+    localparam REG_CTRL         = 4'h0;
+    localparam REG_STATUS       = 4'h1;
+    localparam REG_FRAME_WORDS  = 4'h2;
+    localparam REG_SLOTS        = 4'h3;
+    localparam REG_RATE_DIV     = 4'h4;
+    localparam REG_WR_SLOT      = 4'h5;
+    localparam REG_RELEASE      = 4'h6;
+    localparam REG_PENDING      = 4'h7;
+    localparam REG_CYCLES       = 4'h8;
+    localparam REG_BEATS        = 4'h9;
+    localparam REG_FRAMES       = 4'hA;
+    localparam REG_DROP_BEATS   = 4'hB;
+    localparam REG_DROP_FRAMES  = 4'hC;
+    localparam REG_STALL_CYCLES = 4'hD;
+    localparam REG_FILL_MAX     = 4'hE;
+    localparam REG_ID           = 4'hF;
+
+    wire clk   = s_axi_aclk;
+    wire rst_n = s_axi_aresetn;
+
+    //--------------------------------------------------------------------------
+    // 설정 레지스터
+    //--------------------------------------------------------------------------
+    reg        enable;
+    reg        drop_on_full;
+    reg [15:0] frame_words;
+    reg [15:0] slots;
+    reg [15:0] rate_div;
+    reg        clear;
+    reg        release_valid;
+    reg [15:0] release_count;
+
+    //--------------------------------------------------------------------------
+    // AXI4-Lite 쓰기 (주소/데이터가 함께 올 때 한 번에 받음)
+    //--------------------------------------------------------------------------
+    wire       wr_en  = s_axi_awvalid && s_axi_wvalid && !s_axi_bvalid;
+    wire [3:0] wr_reg = s_axi_awaddr[5:2];
+
+    assign s_axi_awready = wr_en;
+    assign s_axi_wready  = wr_en;
+    assign s_axi_bresp   = 2'b00;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            s_axi_bvalid  <= 1'b0;
+            enable        <= 1'b0;
+            drop_on_full  <= 1'b0;
+            frame_words   <= 16'd256;
+            slots         <= 16'd8;
+            rate_div      <= 16'd0;
+            clear         <= 1'b0;
+            release_valid <= 1'b0;
+            release_count <= 16'd0;
+        end else begin
+            clear         <= 1'b0;
+            release_valid <= 1'b0;
+
+            if (s_axi_bvalid && s_axi_bready)
+                s_axi_bvalid <= 1'b0;
+
+            if (wr_en) begin
+                s_axi_bvalid <= 1'b1;
+                case (wr_reg)
+                    REG_CTRL: begin
+                        enable       <= s_axi_wdata[0];
+                        drop_on_full <= s_axi_wdata[1];
+                        clear        <= s_axi_wdata[31];
+                    end
+                    REG_FRAME_WORDS: frame_words <= s_axi_wdata[15:0];
+                    REG_SLOTS:       slots       <= s_axi_wdata[15:0];
+                    REG_RATE_DIV:    rate_div    <= s_axi_wdata[15:0];
+                    REG_RELEASE: begin
+                        release_valid <= 1'b1;
+                        release_count <= s_axi_wdata[15:0];
+                    end
+                    default: ;
+                endcase
+            end
+        end
+    end
+
+    //--------------------------------------------------------------------------
+    // 발생기 / writer
+    //--------------------------------------------------------------------------
+    wire [15:0] wr_slot;
+    wire [15:0] pending;
+    wire        in_frame;
+    wire        ev_beat, ev_frame, ev_drop_beat, ev_drop_frame, ev_stall;
+
+    axis_pattern_gen u_gen (
+        .clk            (clk),
+        .rst_n          (rst_n),
+        .enable         (enable),
+        .frame_words    (frame_words),
+        .rate_div       (rate_div),
+        .m_axis_tdata   (m_axis_tdata),
+        .m_axis_tlast   (m_axis_tlast),
+        .m_axis_tvalid  (m_axis_tvalid),
+        .m_axis_tready  (m_axis_tready)
+    );
+
+    axis_bram_writer u_writer (
+        .clk            (clk),
+        .rst_n          (rst_n),
+        .enable         (enable),
+        .drop_on_full   (drop_on_full),
+        .frame_words    (frame_words),
+        .slots          (slots),
+        .release_valid  (release_valid),
+        .release_count  (release_count),
+        .s_axis_tdata   (s_axis_tdata),
+        .s_axis_tlast   (s_axis_tlast),
+        .s_axis_tvalid  (s_axis_tvalid),
+        .s_axis_tready  (s_axis_tready),
+        .bram_en        (bram_en_b),
+        .bram_we        (bram_we_b),
+        .bram_addr      (bram_addr_b),
+        .bram_din       (bram_wrdata_b),
+        .wr_slot        (wr_slot),
+        .pending        (pending),
+        .in_frame       (in_frame),
+        .ev_beat        (ev_beat),
+        .ev_frame       (ev_frame),
+        .ev_drop_beat   (ev_drop_beat),
+        .ev_drop_frame  (ev_drop_frame),
+        .ev_stall       (ev_stall)
+    );
+
+    assign bram_clk_b = clk;
+    assign bram_rst_b = !rst_n;
+
+    //--------------------------------------------------------------------------
+    // 카운터
+    //--------------------------------------------------------------------------
+    reg [31:0] cnt_cycles;
+    reg [31:0] cnt_beats;
+    reg [31:0] cnt_frames;
+    reg [31:0] cnt_drop_beats;
+    reg [31:0] cnt_drop_frames;
+    reg [31:0] cnt_stall;
+    reg [15:0] fill_max;
+    reg [15:0] pending_q;       // writer의 BRAM 쓰기 레지스터만큼 늦춘 PENDING
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n)
+            pending_q <= 16'd0;
+        else
+            pending_q <= pending;
+    end
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            cnt_cycles      <= 32'd0;
+            cnt_beats       <= 32'd0;
+            cnt_frames      <= 32'd0;
+            cnt_drop_beats  <= 32'd0;
+            cnt_drop_frames <= 32'd0;
+            cnt_stall       <= 32'd0;
+            fill_max        <= 16'd0;
+        end else if (clear) begin
+            cnt_cycles      <= 32'd0;
+            cnt_beats       <= 32'd0;
+            cnt_frames      <= 32'd0;
+            cnt_drop_beats  <= 32'd0;
+            cnt_drop_frames <= 32'd0;
+            cnt_stall       <= 32'd0;
+            fill_max        <= 16'd0;
+        end else begin
+            if (enable)        cnt_cycles      <= cnt_cycles + 32'd1;
+            if (ev_beat)       cnt_beats       <= cnt_beats + 32'd1;
+            if (ev_frame)      cnt_frames      <= cnt_frames + 32'd1;
+            if (ev_drop_beat)  cnt_drop_beats  <= cnt_drop_beats + 32'd1;
+            if (ev_drop_frame) cnt_drop_frames <= cnt_drop_frames + 32'd1;
+            if (ev_stall)      cnt_stall       <= cnt_stall + 32'd1;
+            if (pending > fill_max)
+                fill_max <= pending;
+        end
+    end
+
+    //--------------------------------------------------------------------------
+    // AXI4-Lite 읽기
+    //--------------------------------------------------------------------------
+    assign s_axi_arready = s_axi_arvalid && !s_axi_rvalid;
+    assign s_axi_rresp   = 2'b00;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            s_axi_rvalid <= 1'b0;
+            s_axi_rdata  <= 32'd0;
+        end else begin
+            if (s_axi_rvalid && s_axi_rready)
+                s_axi_rvalid <= 1'b0;
+
+            if (s_axi_arready) begin
+                s_axi_rvalid <= 1'b1;
+                case (s_axi_araddr[5:2])
+                    REG_CTRL:         s_axi_rdata <= {30'd0, drop_on_full, enable};
+                    REG_STATUS:       s_axi_rdata <= {30'd0, in_frame, enable};
+                    REG_FRAME_WORDS:  s_axi_rdata <= {16'd0, frame_words};
+                    REG_SLOTS:        s_axi_rdata <= {16'd0, slots};
+                    REG_RATE_DIV:     s_axi_rdata <= {16'd0, rate_div};
+                    REG_WR_SLOT:      s_axi_rdata <= {16'd0, wr_slot};
+                    REG_PENDING:      s_axi_rdata <= {16'd0, pending_q};
+                    REG_CYCLES:       s_axi_rdata <= cnt_cycles;
+                    REG_BEATS:        s_axi_rdata <= cnt_beats;
+                    REG_FRAMES:       s_axi_rdata <= cnt_frames;
+                    REG_DROP_BEATS:   s_axi_rdata <= cnt_drop_beats;
+                    REG_DROP_FRAMES:  s_axi_rdata <= cnt_drop_frames;
+                    REG_STALL_CYCLES: s_axi_rdata <= cnt_stall;
+                    REG_FILL_MAX:     s_axi_rdata <= {16'd0, fill_max};
+                    REG_ID:           s_axi_rdata <= INGEST_ID;
+                    default:          s_axi_rdata <= 32'd0;
+                endcase
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,410 @@
+#==============================================================================
+# KV260 BRAM App - benchmark result history and regression check
+#
+# Collects "@BENCH {...}" JSON lines (see vitis/src/bram_result.c) from
+# captured UART logs, appends them to a JSON-lines history file and compares
+# every new record against the median of its previous runs. Runs offline on
+# plain tclsh. Exit code 1 if any regression is found.
+#
+# Usage:
+#   tclsh tools/bench_history.tcl [options] <history.jsonl> <uart.log> ...
+#   tclsh tools/bench_history.tcl -show <history.jsonl>
+#
+#   Records are matched on test, case, width, cache mode and PL clock (MHz).
+#   A record that is already in the history (same content: build, build
+#   time, case and measured values) is compared without itself in the
+#   baseline and is not appended again, so re-importing a log that keeps
+#   growing (or the same log twice) is safe. A log without any @BENCH
+#   record is an error.
+#   Stream ingest records carry ingest_mbps/consume_mbps (checked like
+#   wr_mbps/rd_mbps) and drop_beats/drop_frames (a loss where the baseline
+#   had none is always a regression).
+#   Regressions are followed by the SYSMON readings of the run and of the
+#   baseline (PL temperature, lowest VCCINT) when the records carry them.
+#   A regressed record is not appended unless -accept is given, so a bad run
+#   never becomes part of the baseline by itself. Records whose build is
+#   "unknown" (BRAM_BUILD_HASH not set) are refused unless -allow-unknown is
+#   given, since runs of different builds could not be told apart.
+#
+# Options:
+#   -threshold PCT max allowed MB/s drop in percent           (default 5)
+#   -latency PCT   max allowed p50/p99 latency growth in percent (default 10)
+#   -drops PCT     max allowed dropped beat/frame growth in percent (default 10)
+#   -window N      baseline = median of the last N runs        (default 5)
+#   -run NAME      run label stored with the records (default: log file name,
+#                  informational only - duplicates are detected by content)
+#   -no-save       compare only, do not append to the history
+#   -accept        also append regressed records (new numbers are expected)
+#   -allow-unknown save records built without BRAM_BUILD_HASH
+#   -show          print the history per key and exit
+#==============================================================================
+
+source [file join [file dirname [file normalize [info script]]] report_summary.tcl]
+
+set thr_mbps 5.0
+set thr_lat  10.0
+set thr_drop 10.0
+set window   5
+set run_name ""
+set save     1
+set accept   0
+set allow_unknown 0
+set show     0
+set files    {}
+
+for {set i 0} {$i < [llength $argv]} {incr i} {
+    set a [lindex $argv $i]
+    switch -- $a {
+        -threshold { set thr_mbps [lindex $argv [incr i]] }
+        -latency   { set thr_lat  [lindex $argv [incr i]] }
+        -drops     { set thr_drop [lindex $argv [incr i]] }
+        -window    { set window   [lindex $argv [incr i]] }
+        -run       { set run_name [lindex $argv [incr i]] }
+        -no-save   { set save 0 }
+        -accept    { set accept 1 }
+        -allow-unknown { set allow_unknown 1 }
+        -show      { set show 1 }
+        default    { lappend files $a }
+    }
+}
+
+if {[llength $files] < 1 || (!$show && [llength $files] < 2)} {
+    puts "Usage: tclsh bench_history.tcl \[options\] <history.jsonl> <uart.log> ..."
+    puts "       tclsh bench_history.tcl -show <history.jsonl>"
+    exit 1
+}
+set history_file [lindex $files 0]
+set logs [lrange $files 1 end]
+
+#------------------------------------------------------------------------------
+# Records
+#------------------------------------------------------------------------------
+proc to_jsonl {d} {
+    return [string map {"\n  " "" "\n" ""} [report_summary::to_json $d]]
+}
+
+proc record_key {r} {
+    set mhz ""
+    if {[string is double -strict [dict get $r pl_khz]]} {
+        set mhz [expr {round([dict get $r pl_khz] / 1000.0)}]
+    }
+    return [list [dict get $r test] [dict get $r case] [dict get $r width] \
+                 [dict get $r cache] $mhz]
+}
+
+# Identity of one measurement: every field except the import bookkeeping.
+# Empty fields (null, or not carried by an older record) do not count.
+proc record_id {r} {
+    dict unset r run
+    dict unset r imported
+    dict for {k v} $r {
+        if {$v eq ""} {
+            dict unset r $k
+        }
+    }
+    return [lsort -stride 2 -index 0 $r]
+}
+
+proc key_label {key} {
+    lassign $key test case width cache mhz
+    return "$test / $case (${width}b, $cache, $mhz MHz)"
+}
+
+# "@BENCH {...}" lines of a captured log (CR/LF and terminal prefixes tolerated)
+proc parse_log {path} {
+    set recs {}
+    foreach line [split [report_summary::read_file $path] "\n"] {
+        set p [string first "@BENCH " $line]
+        if {$p < 0} {
+            continue
+        }
+        set r [report_summary::from_json [string range $line $p+7 end]]
+        if {![dict exists $r test] || ![dict exists $r case]} {
+            continue
+        }
+        foreach k {pl_khz width cache wr_mbps rd_mbps lat_p50_ns lat_p90_ns lat_p99_ns
+                   pl_temp_c vccint_min_mv ingest_mbps consume_mbps drop_beats drop_frames} {
+            if {![dict exists $r $k]} {
+                dict set r $k ""
+            }
+        }
+        lappend recs $r
+    }
+    return $recs
+}
+
+# Field value, "" if the record predates the field
+proc field {r k} {
+    if {[dict exists $r $k]} {
+        return [dict get $r $k]
+    }
+    return ""
+}
+
+proc load_history {path} {
+    set recs {}
+    if {![file exists $path]} {
+        return $recs
+    }
+    foreach line [split [report_summary::read_file $path] "\n"] {
+        if {[string trim $line] ne ""} {
+            lappend recs [report_summary::from_json $line]
+        }
+    }
+    return $recs
+}
+
+proc median {values} {
+    set values [lsort -real $values]
+    set n [llength $values]
+    if {$n == 0} {
+        return ""
+    }
+    if {$n % 2} {
+        return [lindex $values [expr {$n / 2}]]
+    }
+    return [expr {([lindex $values [expr {$n / 2 - 1}]] + [lindex $values [expr {$n / 2}]]) / 2.0}]
+}
+
+# Baseline value of field over the last $window runs of the same key
+proc baseline {hist key field window} {
+    set values {}
+    foreach r $hist {
+        if {[record_key $r] eq $key && [string is double -strict [field $r $field]]} {
+            lappend values [dict get $r $field]
+        }
+    }
+    return [median [lrange $values end-[expr {$window - 1}] end]]
+}
+
+# Write/read column of -show (stream records: ingest/consume)
+proc rate_field {r dir} {
+    set v [field $r [expr {$dir eq "wr" ? "ingest_mbps" : "consume_mbps"}]]
+    if {$v ne ""} {
+        return $v
+    }
+    return [field $r ${dir}_mbps]
+}
+
+proc fmt_value {v} {
+    if {[string is integer -strict $v] || ![string is double -strict $v]} {
+        return $v
+    }
+    return [format "%.2f" $v]
+}
+
+proc change_pct {base cur} {
+    if {![string is double -strict $base] || ![string is double -strict $cur] || $base == 0} {
+        return ""
+    }
+    return [expr {($cur - $base) * 100.0 / $base}]
+}
+
+set history [load_history $history_file]
+
+#------------------------------------------------------------------------------
+# -show: history per key
+#------------------------------------------------------------------------------
+if {$show} {
+    set keys {}
+    foreach r $history {
+        set k [record_key $r]
+        if {[lsearch -exact $keys $k] < 0} {
+            lappend keys $k
+        }
+    }
+    foreach k $keys {
+        puts [key_label $k]
+        foreach r $history {
+            if {[record_key $r] eq $k} {
+                puts [format "  %-24s %-10s %10s %10s %8s %8s %8s %6s" \
+                    [dict get $r run] [dict get $r build] \
+                    [rate_field $r wr] [rate_field $r rd] \
+                    [dict get $r lat_p50_ns] [dict get $r lat_p99_ns] \
+                    [field $r pl_temp_c] [field $r vccint_min_mv]]
+            }
+        }
+    }
+    exit 0
+}
+
+#------------------------------------------------------------------------------
+# Import and compare
+#------------------------------------------------------------------------------
+set known [dict create]
+foreach r $history {
+    dict set known [record_id $r] 1
+}
+
+# Parse every log before touching the history file
+set log_recs [dict create]
+foreach log $logs {
+    set recs [parse_log $log]
+    if {[llength $recs] == 0} {
+        puts stderr "ERROR: no @BENCH records in $log"
+        exit 2
+    }
+    if {$save && !$allow_unknown} {
+        foreach r $recs {
+            if {[field $r build] in {"" unknown}} {
+                puts stderr "ERROR: $log has records from build 'unknown'"
+                puts stderr "       Define BRAM_BUILD_HASH=\\\"<git hash>\\\" in the app build, or pass"
+                puts stderr "       -allow-unknown (or -no-save to compare only)."
+                exit 2
+            }
+        }
+    }
+    dict set log_recs $log $recs
+}
+
+set regressions 0
+set imported 0
+set held 0
+set fh ""
+if {$save} {
+    set fh [open $history_file a]
+}
+
+foreach log $logs {
+    set run [expr {$run_name ne "" ? $run_name : [file tail $log]}]
+    set recs [dict get $log_recs $log]
+
+    puts "======================================"
+    puts " $run ([llength $recs] records)"
+    puts "======================================"
+
+    # Baseline never includes the records being checked (re-imported log)
+    set ids [dict create]
+    foreach r $recs {
+        dict set ids [record_id $r] 1
+    }
+    set hist {}
+    foreach r $history {
+        if {![dict exists $ids [record_id $r]]} {
+            lappend hist $r
+        }
+    }
+    set duplicates 0
+
+    puts [format " %-44s %-10s %10s %10s %9s" "Record" "Metric" "Baseline" "Current" "Delta"]
+    puts " ------------------------------------------------------------------------------------"
+    foreach r $recs {
+        set key [record_key $r]
+        set label [key_label $key]
+        set compared 0
+        set rec_bad 0
+
+        # Throughput: lower is worse
+        foreach field {wr_mbps rd_mbps ingest_mbps consume_mbps} {
+            set b [baseline $hist $key $field $window]
+            set c [field $r $field]
+            set d [change_pct $b $c]
+            if {$d eq ""} {
+                continue
+            }
+            set bad [expr {-$d > $thr_mbps}]
+            puts [format " %-44s %-10s %10s %10s %+8.1f%%%s" $label $field [fmt_value $b] $c $d \
+                [expr {$bad ? "  <-- REGRESSION" : ""}]]
+            incr regressions $bad
+            incr rec_bad $bad
+            set label ""
+            set compared 1
+        }
+
+        # Latency: higher is worse
+        foreach field {lat_p50_ns lat_p99_ns} {
+            set b [baseline $hist $key $field $window]
+            set c [field $r $field]
+            set d [change_pct $b $c]
+            if {$d eq ""} {
+                continue
+            }
+            set bad [expr {$d > $thr_lat}]
+            puts [format " %-44s %-10s %10s %10s %+8.1f%%%s" $label $field [fmt_value $b] $c $d \
+                [expr {$bad ? "  <-- REGRESSION" : ""}]]
+            incr regressions $bad
+            incr rec_bad $bad
+            set label ""
+            set compared 1
+        }
+
+        # Stream losses: higher is worse, any loss is a regression on a clean baseline
+        foreach field {drop_beats drop_frames} {
+            set b [baseline $hist $key $field $window]
+            set c [field $r $field]
+            if {$b eq "" || ![string is double -strict $c]} {
+                continue
+            }
+            if {$b == 0} {
+                set bad [expr {$c > 0}]
+                set delta [format "%9s" [expr {$bad ? "new" : "+0.0%"}]]
+            } else {
+                set d [change_pct $b $c]
+                set bad [expr {$d > $thr_drop}]
+                set delta [format "%+8.1f%%" $d]
+            }
+            puts [format " %-44s %-10s %10s %10s %s%s" $label $field [fmt_value $b] $c $delta \
+                [expr {$bad ? "  <-- REGRESSION" : ""}]]
+            incr regressions $bad
+            incr rec_bad $bad
+            set label ""
+            set compared 1
+        }
+
+        # Operating conditions next to a regression (not checked themselves)
+        if {$rec_bad} {
+            foreach f {pl_temp_c vccint_min_mv} {
+                set b [baseline $hist $key $f $window]
+                set c [field $r $f]
+                if {$b ne "" && [string is double -strict $c]} {
+                    puts [format " %-44s %-10s %10s %10s %+8.2f" "" $f [fmt_value $b] $c \
+                        [expr {$c - $b}]]
+                }
+            }
+        }
+
+        if {!$compared} {
+            puts [format " %-44s %s" $label "new (no history)"]
+        }
+
+        set id [record_id $r]
+        if {[dict exists $known $id]} {
+            incr duplicates
+            continue
+        }
+        # A regressed record stays out of the baseline unless accepted
+        if {$rec_bad && !$accept} {
+            incr held
+            continue
+        }
+        dict set known $id 1
+        dict set r run $run
+        dict set r imported [clock format [clock seconds] -format "%Y-%m-%dT%H:%M:%S"]
+        # Later logs of this invocation compare against this one too
+        lappend history $r
+        if {$save} {
+            puts $fh [to_jsonl $r]
+            incr imported
+        }
+    }
+    if {$duplicates > 0} {
+        puts " $duplicates record(s) already in the history - not saved again"
+    }
+}
+
+if {$fh ne ""} {
+    close $fh
+    puts ""
+    puts "History: $imported record(s) appended to $history_file"
+    if {$held > 0} {
+        puts "         $held regressed record(s) not saved (re-run with -accept to make them the baseline)"
+    }
+}
+
+puts ""
+if {$regressions > 0} {
+    puts "RESULT: $regressions regression(s) found"
+    exit 1
+}
+puts "RESULT: no regressions"
+exit 0
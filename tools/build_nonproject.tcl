@@ -0,0 +1,213 @@
+#==============================================================================
+# KV260 Build Variants - Non-project (in-memory) Vivado flow
+#
+# Builds one variant with synth_design / opt_design / place_design /
+# phys_opt_design / route_design / write_bitstream instead of synth_1/impl_1
+# project runs. The block design and sources come from the variant's own
+# create_project.tcl, so both flows always build the same design.
+#
+# A checkpoint is written after every stage and the wall-clock time of each
+# stage is stored in <out>/stage_times.csv. Timing/utilization reports and
+# build_summary.json (see report_summary.tcl) are written after routing.
+#
+# Usage:
+#   vivado -mode batch -source tools/build_nonproject.tcl \
+#          -tclargs <variant> [-incremental <ref.dcp>] [-out <dir>]
+#
+#   <variant>        name from variants.tcl (e.g. bram_ila)
+#   -incremental     reference routed DCP for incremental implementation
+#                    (default: <out>/post_route.dcp from the previous run)
+#   -no-incremental  always implement from scratch
+#   -out             output directory (default: <variant dir>/nonproject)
+#==============================================================================
+
+set tools_dir [file dirname [file normalize [info script]]]
+set repo_dir  [file dirname $tools_dir]
+source [file join $tools_dir variants.tcl]
+source [file join $tools_dir report_summary.tcl]
+
+set part_number "xck26-sfvc784-2LV-c"
+set board_part  "xilinx.com:kv260_som:part0:1.4"
+set bd_name     "design_1"
+
+#------------------------------------------------------------------------------
+# Arguments
+#------------------------------------------------------------------------------
+set variant  ""
+set ref_dcp  ""
+set use_incr 1
+set out_dir  ""
+
+for {set i 0} {$i < [llength $argv]} {incr i} {
+    set a [lindex $argv $i]
+    switch -- $a {
+        -incremental    { set ref_dcp [file normalize [lindex $argv [incr i]]] }
+        -no-incremental { set use_incr 0 }
+        -out            { set out_dir [file normalize [lindex $argv [incr i]]] }
+        default         { set variant $a }
+    }
+}
+
+if {![dict exists $VARIANTS $variant]} {
+    puts "ERROR: unknown variant '$variant'"
+    puts "Known variants: [dict keys $VARIANTS]"
+    return -code error "unknown variant"
+}
+
+set vdir         [file join $repo_dir [dict get $VARIANTS $variant dir]]
+set project_name [dict get $VARIANTS $variant project]
+if {$out_dir eq ""} {
+    set out_dir [file join $vdir nonproject]
+}
+if {$use_incr && $ref_dcp eq ""} {
+    set ref_dcp [file join $out_dir post_route.dcp]
+}
+file mkdir $out_dir
+
+#------------------------------------------------------------------------------
+# Stage timing
+#------------------------------------------------------------------------------
+set stage_log {}
+
+proc run_stage {name script} {
+    global stage_log
+    puts "======================================"
+    puts " $name"
+    puts "======================================"
+    set t0 [clock milliseconds]
+    uplevel 1 $script
+    set dt [expr {([clock milliseconds] - $t0) / 1000.0}]
+    lappend stage_log $name $dt
+    puts " $name: [format %.1f $dt] s"
+}
+
+#------------------------------------------------------------------------------
+# 1. Block design + wrapper from the variant's create_project.tcl
+#------------------------------------------------------------------------------
+run_stage "create_bd" {
+    set project_dir_saved [pwd]
+    # create_project.tcl reads its options (-pl_clk/-ecc/...) from argv
+    set argv_saved $argv
+    set argv [dict get $VARIANTS $variant options]
+    cd $vdir
+    source [file join $vdir create_project.tcl]
+    cd $project_dir_saved
+    set argv $argv_saved
+
+    set bd_file [get_files -quiet $bd_name.bd]
+    set_property synth_checkpoint_mode None $bd_file
+    generate_target all $bd_file
+
+    # Collect every non-BD source the project knows about (wrapper, RTL, XDC)
+    set hdl_files {}
+    foreach f [get_files -quiet -of_objects [get_filesets sources_1]] {
+        if {[file extension $f] in {.v .sv .vhd}} {
+            lappend hdl_files $f
+        }
+    }
+    set xdc_files [get_files -quiet -of_objects [get_filesets constrs_1]]
+    set bd_path [file normalize $bd_file]
+    close_project
+}
+
+#------------------------------------------------------------------------------
+# 2. Non-project synthesis
+#------------------------------------------------------------------------------
+run_stage "synth_design" {
+    create_project -in_memory -part $part_number
+    set_property board_part $board_part [current_project]
+
+    read_bd $bd_path
+    foreach f $hdl_files {
+        if {[file extension $f] eq ".vhd"} {
+            read_vhdl $f
+        } else {
+            read_verilog $f
+        }
+    }
+    foreach f $xdc_files {
+        read_xdc $f
+    }
+
+    synth_design -top ${bd_name}_wrapper -part $part_number \
+        -directive PerformanceOptimized
+    write_checkpoint -force $out_dir/post_synth.dcp
+}
+
+#------------------------------------------------------------------------------
+# 3. Implementation (optionally incremental)
+#------------------------------------------------------------------------------
+run_stage "opt_design" {
+    opt_design
+    write_checkpoint -force $out_dir/post_opt.dcp
+}
+
+set incremental 0
+if {$use_incr && [file exists $ref_dcp]} {
+    # Keep the reference out of the way: post_route.dcp is overwritten below
+    set ref_copy [file join $out_dir reference.dcp]
+    if {[file normalize $ref_dcp] ne [file normalize $ref_copy]} {
+        file copy -force $ref_dcp $ref_copy
+    }
+    read_checkpoint -incremental $ref_copy
+    set incremental 1
+    puts "Incremental implementation from: $ref_dcp"
+}
+
+run_stage "place_design" {
+    place_design -directive [expr {$incremental ? "Default" : "ExtraTimingOpt"}]
+    write_checkpoint -force $out_dir/post_place.dcp
+}
+
+run_stage "phys_opt_design" {
+    phys_opt_design -directive Explore
+    write_checkpoint -force $out_dir/post_physopt.dcp
+}
+
+run_stage "route_design" {
+    route_design -directive [expr {$incremental ? "Default" : "Explore"}]
+    write_checkpoint -force $out_dir/post_route.dcp
+}
+
+#------------------------------------------------------------------------------
+# 4. Bitstream + XSA + debug probes
+#------------------------------------------------------------------------------
+run_stage "write_bitstream" {
+    write_bitstream -force $out_dir/${bd_name}_wrapper.bit
+
+    if {[llength [get_debug_cores -quiet]] > 0} {
+        write_debug_probes -force $out_dir/${project_name}.ltx
+    }
+    if {[catch {write_hw_platform -fixed -include_bit -force \
+            -file $out_dir/${project_name}.xsa} msg]} {
+        puts "WARNING: XSA export skipped: $msg"
+    }
+}
+
+#------------------------------------------------------------------------------
+# 5. Stage timing report
+#------------------------------------------------------------------------------
+set csv [open $out_dir/stage_times.csv w]
+puts $csv "variant,stage,seconds,incremental"
+set total 0.0
+puts ""
+puts "======================================"
+puts " Non-project build: $variant"
+puts "======================================"
+foreach {name dt} $stage_log {
+    puts $csv "$variant,$name,$dt,$incremental"
+    puts [format " %-16s %8.1f s" $name $dt]
+    set total [expr {$total + $dt}]
+}
+puts $csv "$variant,total,$total,$incremental"
+close $csv
+
+report_timing_summary -file $out_dir/timing_summary.rpt
+report_utilization -file $out_dir/utilization.rpt
+report_summary::write $variant $out_dir/timing_summary.rpt \
+    $out_dir/utilization.rpt $total $out_dir/build_summary.json
+puts " ------------------------------"
+puts [format " %-16s %8.1f s" "total" $total]
+puts " Incremental: [expr {$incremental ? "yes" : "no"}]"
+puts " Outputs:     $out_dir"
+puts "======================================"
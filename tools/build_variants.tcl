@@ -0,0 +1,337 @@
+#==============================================================================
+# KV260 Build Variants - parallel, incremental Vivado build driver
+#
+# Builds every LED/BRAM variant (create_project.tcl + build_all.tcl) with a
+# bounded number of concurrent Vivado jobs. A variant is skipped when the hash
+# of its TCL scripts, sources and create_project.tcl options matches the
+# stamp written by the last successful build and its artifact (bit/XSA)
+# still exists.
+#
+# Usage (tclsh, or vivado -mode tcl -source ... -tclargs ...):
+#   tclsh tools/build_variants.tcl [options] [variant ...]
+#
+# Options:
+#   -jobs N        max concurrent Vivado processes (default 2)
+#   -vivado PATH   Vivado executable (default: $env(VIVADO) or "vivado")
+#   -flow F        "project" (create_project.tcl + build_all.tcl, default) or
+#                  "nonproject" (build_nonproject.tcl, in-memory flow)
+#   -force         ignore stamps, rebuild everything selected
+#   -dry-run       only hash and report what would be built (no Vivado needed)
+#   -list          list known variants and exit
+#==============================================================================
+
+set tools_dir [file dirname [file normalize [info script]]]
+set repo_dir  [file dirname $tools_dir]
+source [file join $tools_dir variants.tcl]
+
+set stamp_name ".build_stamp"
+
+# Non-project flow outputs (see build_nonproject.tcl)
+set nonproject_artifact "nonproject/design_1_wrapper.bit"
+
+#------------------------------------------------------------------------------
+# Hashing (tcllib sha256 when available, pure-Tcl FNV-1a 64 otherwise)
+#------------------------------------------------------------------------------
+set have_sha256 [expr {![catch {package require sha256}]}]
+
+proc fnv1a64 {data} {
+    set h 0xcbf29ce484222325
+    binary scan $data cu* bytes
+    foreach b $bytes {
+        set h [expr {(($h ^ $b) * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF}]
+    }
+    return [format %016llx $h]
+}
+
+proc hash_data {data} {
+    global have_sha256
+    if {$have_sha256} {
+        return [sha2::sha256 -hex -- $data]
+    }
+    return [fnv1a64 $data]
+}
+
+# Hash of every input file (sorted by relative path, path included in digest)
+proc variant_hash {vdir patterns} {
+    set files {}
+    foreach pat $patterns {
+        foreach f [glob -nocomplain -types f -directory $vdir $pat] {
+            lappend files $f
+        }
+    }
+    set digest ""
+    foreach f [lsort -unique $files] {
+        set fh [open $f rb]
+        set data [read $fh]
+        close $fh
+        set rel [string range $f [expr {[string length $vdir] + 1}] end]
+        append digest "$rel [hash_data $data]\n"
+    }
+    return [hash_data $digest]
+}
+
+# Inputs and create_project.tcl options together: a different -ecc/-banks/...
+# builds a different design from the same files
+proc variant_options_hash {hash options} {
+    if {[llength $options] == 0} {
+        return $hash
+    }
+    return [hash_data "$hash options: $options"]
+}
+
+proc read_stamp {path} {
+    if {![file exists $path]} {
+        return ""
+    }
+    set fh [open $path r]
+    set h [string trim [read $fh]]
+    close $fh
+    return $h
+}
+
+proc write_stamp {path hash} {
+    set fh [open $path w]
+    puts $fh $hash
+    close $fh
+}
+
+#------------------------------------------------------------------------------
+# Arguments
+#------------------------------------------------------------------------------
+set opt_jobs   2
+set opt_force  0
+set opt_dry    0
+set opt_flow   "project"
+set opt_vivado [expr {[info exists env(VIVADO)] ? $env(VIVADO) : "vivado"}]
+set selected   {}
+
+for {set i 0} {$i < [llength $argv]} {incr i} {
+    set a [lindex $argv $i]
+    switch -- $a {
+        -jobs    { set opt_jobs [lindex $argv [incr i]] }
+        -vivado  { set opt_vivado [lindex $argv [incr i]] }
+        -flow    { set opt_flow [lindex $argv [incr i]] }
+        -force   { set opt_force 1 }
+        -dry-run { set opt_dry 1 }
+        -list {
+            dict for {name v} $VARIANTS {
+                puts [format "%-16s %-36s %s" $name [dict get $v dir] [dict get $v options]]
+            }
+            exit 0
+        }
+        default {
+            if {![dict exists $VARIANTS $a]} {
+                puts "ERROR: unknown variant '$a' (use -list)"
+                exit 1
+            }
+            lappend selected $a
+        }
+    }
+}
+if {![string is integer -strict $opt_jobs] || $opt_jobs < 1} {
+    puts "ERROR: -jobs must be a positive integer"
+    exit 1
+}
+if {$opt_flow ni {project nonproject}} {
+    puts "ERROR: -flow must be 'project' or 'nonproject'"
+    exit 1
+}
+if {$opt_flow eq "nonproject"} {
+    append stamp_name "_nonproject"
+}
+if {[llength $selected] == 0} {
+    set selected [dict keys $VARIANTS]
+}
+
+#------------------------------------------------------------------------------
+# Plan: decide which variants need a build
+#------------------------------------------------------------------------------
+puts "======================================"
+puts " KV260 Build Variants"
+puts "======================================"
+puts " Hash: [expr {$have_sha256 ? {sha256 (tcllib)} : {fnv1a64}}]"
+puts " Flow: $opt_flow"
+puts " Jobs: $opt_jobs[expr {$opt_dry ? { (dry-run)} : {}}]"
+puts ""
+
+set queue {}
+array set result {}
+
+proc variant_artifact {name} {
+    global VARIANTS repo_dir opt_flow nonproject_artifact
+    set vdir [file join $repo_dir [dict get $VARIANTS $name dir]]
+    if {$opt_flow eq "nonproject"} {
+        return [file join $vdir $nonproject_artifact]
+    }
+    return [file join $vdir [dict get $VARIANTS $name artifact]]
+}
+
+foreach name $selected {
+    set v        [dict get $VARIANTS $name]
+    set vdir     [file join $repo_dir [dict get $v dir]]
+    set artifact [variant_artifact $name]
+    set hash     [variant_options_hash [variant_hash $vdir [dict get $v inputs]] \
+                      [dict get $v options]]
+    if {$opt_flow eq "nonproject"} {
+        set hash [hash_data "$hash [variant_hash $tools_dir build_nonproject.tcl]"]
+    }
+    set stamp    [read_stamp [file join $vdir $stamp_name]]
+
+    set result($name,hash) $hash
+    set result($name,time) 0
+
+    if {!$opt_force && $stamp eq $hash && [file exists $artifact]} {
+        set result($name,status) "SKIP"
+        set result($name,reason) "up to date"
+    } else {
+        if {$opt_force} {
+            set reason "forced"
+        } elseif {$stamp eq ""} {
+            set reason "no stamp"
+        } elseif {$stamp ne $hash} {
+            set reason "inputs changed"
+        } else {
+            set reason "artifact missing"
+        }
+        set result($name,status) [expr {$opt_dry ? "BUILD" : "PENDING"}]
+        set result($name,reason) $reason
+        lappend queue $name
+    }
+    puts [format " %-16s %-7s %s" $name \
+        [expr {$result($name,status) eq "SKIP" ? "skip" : "build"}] \
+        $result($name,reason)]
+}
+puts ""
+
+#------------------------------------------------------------------------------
+# Run: bounded pool of Vivado batch processes
+#------------------------------------------------------------------------------
+set running 0
+
+proc vivado_cmd {name} {
+    global opt_vivado opt_flow tools_dir VARIANTS
+    if {$opt_flow eq "nonproject"} {
+        return [list $opt_vivado -mode batch -nojournal \
+            -log build_variants.log \
+            -source [file join $tools_dir build_nonproject.tcl] -tclargs $name]
+    }
+    set cmd [list $opt_vivado -mode batch -nojournal \
+        -log build_variants.log \
+        -source create_project.tcl -source build_all.tcl]
+    set options [dict get $VARIANTS $name options]
+    if {[llength $options] > 0} {
+        lappend cmd -tclargs {*}$options
+    }
+    return $cmd
+}
+
+proc start_next {} {
+    global queue running opt_jobs VARIANTS repo_dir result
+
+    while {$running < $opt_jobs && [llength $queue] > 0} {
+        set name  [lindex $queue 0]
+        set queue [lrange $queue 1 end]
+        set vdir  [file join $repo_dir [dict get $VARIANTS $name dir]]
+
+        set pwd [pwd]
+        cd $vdir
+        if {[catch {open |[concat [vivado_cmd $name] [list 2>@1]] r} chan]} {
+            cd $pwd
+            puts " \[$name\] failed to start: $chan"
+            set result($name,status) "FAIL"
+            continue
+        }
+        cd $pwd
+
+        fconfigure $chan -blocking 0 -buffering line
+        set result($name,start) [clock milliseconds]
+        set result($name,status) "RUNNING"
+        incr running
+        fileevent $chan readable [list job_output $name $chan]
+        puts " \[$name\] started"
+    }
+}
+
+# Artifact exists and was written after the job started (mtime has 1 s resolution)
+proc artifact_fresh {artifact start_ms} {
+    if {![file exists $artifact]} {
+        return 0
+    }
+    return [expr {[file mtime $artifact] >= $start_ms / 1000}]
+}
+
+proc job_output {name chan} {
+    global running result VARIANTS repo_dir stamp_name done
+
+    if {[gets $chan line] >= 0} {
+        # Only surface the stage banners; the full log is in build_variants.log
+        if {[regexp {^(ERROR|CRITICAL WARNING|Synthesis|Implementation|Bitstream|XSA| [a-z_]+: [0-9.]+ s)} $line]} {
+            puts " \[$name\] $line"
+        }
+        return
+    }
+    if {![eof $chan]} {
+        return
+    }
+
+    fconfigure $chan -blocking 1
+    set ok [expr {![catch {close $chan}]}]
+    set result($name,time) [expr {([clock milliseconds] - $result($name,start)) / 1000.0}]
+
+    set vdir     [file join $repo_dir [dict get $VARIANTS $name dir]]
+    set artifact [variant_artifact $name]
+    # A bit/XSA left over from an earlier run does not prove this build worked
+    if {$ok && [artifact_fresh $artifact $result($name,start)]} {
+        write_stamp [file join $vdir $stamp_name] $result($name,hash)
+        set result($name,status) "OK"
+    } else {
+        set result($name,status) "FAIL"
+    }
+    puts " \[$name\] $result($name,status) ([format %.1f $result($name,time)] s)"
+
+    incr running -1
+    start_next
+    if {$running == 0} {
+        set done 1
+    }
+}
+
+set t_start [clock milliseconds]
+
+if {$opt_dry} {
+    foreach name $queue {
+        puts " \[$name\] would run in [dict get $VARIANTS $name dir]:"
+        puts "     [vivado_cmd $name]"
+    }
+} elseif {[llength $queue] > 0} {
+    set done 0
+    start_next
+    if {$running > 0} {
+        vwait done
+    }
+}
+
+set t_total [expr {([clock milliseconds] - $t_start) / 1000.0}]
+
+#------------------------------------------------------------------------------
+# Timing table
+#------------------------------------------------------------------------------
+puts ""
+puts "======================================"
+puts " Build Summary"
+puts "======================================"
+puts [format " %-16s %-7s %10s  %s" "Variant" "Status" "Time (s)" "Hash"]
+puts " ------------------------------------------------------------"
+set failed 0
+foreach name $selected {
+    if {$result($name,status) eq "FAIL"} {
+        incr failed
+    }
+    puts [format " %-16s %-7s %10.1f  %s" $name $result($name,status) \
+        $result($name,time) [string range $result($name,hash) 0 11]]
+}
+puts " ------------------------------------------------------------"
+puts [format " %-16s %-7s %10.1f" "Total" "" $t_total]
+puts "======================================"
+
+exit [expr {$failed > 0 ? 1 : 0}]
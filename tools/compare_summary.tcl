@@ -0,0 +1,134 @@
+#==============================================================================
+# KV260 Build Variants - build summary regression check
+#
+# Compares build_summary.json files (see report_summary.tcl) against stored
+# baselines and flags regressions. Exit code 1 if any regression is found.
+#
+# Usage:
+#   tclsh tools/compare_summary.tcl [options] <baseline_dir> <summary.json> ...
+#
+#   Baseline file for a summary is <baseline_dir>/<variant>.json
+#
+# Options:
+#   -wns NS        max allowed WNS drop in ns           (default 0.1)
+#   -fmax PCT      max allowed Fmax drop in percent     (default 2)
+#   -util PCT      max allowed LUT/FF/BRAM/URAM/DSP growth in percent (default 5)
+#   -time PCT      max allowed build time growth in percent (default 25)
+#   -update        copy the given summaries into <baseline_dir> as new baseline
+#==============================================================================
+
+source [file join [file dirname [file normalize [info script]]] report_summary.tcl]
+
+set thr_wns  0.1
+set thr_fmax 2.0
+set thr_util 5.0
+set thr_time 25.0
+set update   0
+set files    {}
+
+for {set i 0} {$i < [llength $argv]} {incr i} {
+    set a [lindex $argv $i]
+    switch -- $a {
+        -wns    { set thr_wns  [lindex $argv [incr i]] }
+        -fmax   { set thr_fmax [lindex $argv [incr i]] }
+        -util   { set thr_util [lindex $argv [incr i]] }
+        -time   { set thr_time [lindex $argv [incr i]] }
+        -update { set update 1 }
+        default { lappend files $a }
+    }
+}
+
+if {[llength $files] < 2} {
+    puts "Usage: tclsh compare_summary.tcl \[options\] <baseline_dir> <summary.json> ..."
+    exit 1
+}
+set baseline_dir [lindex $files 0]
+set files [lrange $files 1 end]
+
+# Growth of a "lower is better" value in percent (empty if not comparable)
+proc growth_pct {base cur} {
+    if {![string is double -strict $base] || ![string is double -strict $cur]} {
+        return ""
+    }
+    if {$base == 0} {
+        return [expr {$cur > 0 ? 100.0 : 0.0}]
+    }
+    return [expr {($cur - $base) * 100.0 / $base}]
+}
+
+set regressions 0
+
+foreach f $files {
+    set cur     [report_summary::from_json [report_summary::read_file $f]]
+    set variant [dict get $cur variant]
+    set bfile   [file join $baseline_dir $variant.json]
+
+    puts "======================================"
+    puts " $variant"
+    puts "======================================"
+
+    if {$update} {
+        file mkdir $baseline_dir
+        file copy -force $f $bfile
+        puts " Baseline updated: $bfile"
+        continue
+    }
+    if {![file exists $bfile]} {
+        puts " No baseline ($bfile) - skipped"
+        continue
+    }
+    set base [report_summary::from_json [report_summary::read_file $bfile]]
+
+    set rows {}
+
+    # Slack: absolute drop in ns
+    foreach key {wns_ns whs_ns} {
+        set b [dict get $base $key]
+        set c [dict get $cur $key]
+        if {[string is double -strict $b] && [string is double -strict $c]} {
+            set bad [expr {($b - $c) > $thr_wns || ($c < 0 && $b >= 0)}]
+            lappend rows [list $key $b $c [format "%+.3f ns" [expr {$c - $b}]] $bad]
+        }
+    }
+
+    # TNS: any new failing slack is a regression
+    set b [dict get $base tns_ns]
+    set c [dict get $cur tns_ns]
+    if {[string is double -strict $b] && [string is double -strict $c]} {
+        lappend rows [list tns_ns $b $c [format "%+.3f ns" [expr {$c - $b}]] [expr {$c < $b}]]
+    }
+
+    # Fmax: relative drop
+    set g [growth_pct [dict get $base fmax_mhz] [dict get $cur fmax_mhz]]
+    if {$g ne ""} {
+        lappend rows [list fmax_mhz [dict get $base fmax_mhz] [dict get $cur fmax_mhz] \
+            [format "%+.1f %%" $g] [expr {-$g > $thr_fmax}]]
+    }
+
+    # Resources and build time: relative growth
+    foreach {key thr} [list lut $thr_util ff $thr_util bram $thr_util \
+                            uram $thr_util dsp $thr_util build_time_s $thr_time] {
+        set g [growth_pct [dict get $base $key] [dict get $cur $key]]
+        if {$g ne ""} {
+            lappend rows [list $key [dict get $base $key] [dict get $cur $key] \
+                [format "%+.1f %%" $g] [expr {$g > $thr}]]
+        }
+    }
+
+    puts [format " %-14s %12s %12s %12s" "Metric" "Baseline" "Current" "Delta"]
+    puts " ----------------------------------------------------"
+    foreach r $rows {
+        lassign $r key b c delta bad
+        puts [format " %-14s %12s %12s %12s%s" $key $b $c $delta \
+            [expr {$bad ? "  <-- REGRESSION" : ""}]]
+        incr regressions $bad
+    }
+}
+
+puts ""
+if {$regressions > 0} {
+    puts "RESULT: $regressions regression(s) found"
+    exit 1
+}
+puts "RESULT: no regressions"
+exit 0
@@ -0,0 +1,211 @@
+#==============================================================================
+# KV260 Build Variants - timing/utilization summary extraction
+#
+# Parses report_timing_summary / report_utilization text reports and writes a
+# flat JSON summary per variant:
+#   variant, wns_ns, tns_ns, whs_ns, ths_ns, clock, period_ns, fmax_mhz,
+#   lut, ff, bram, uram, dsp, build_time_s
+#
+# Sourced by build_all.tcl / build_nonproject.tcl (Vivado), or run standalone
+# on saved reports (plain tclsh, no Vivado needed):
+#   tclsh tools/report_summary.tcl <variant> <timing.rpt> <util.rpt> \
+#         [build_time_s] [out.json]
+#==============================================================================
+
+namespace eval report_summary {}
+
+proc report_summary::read_file {path} {
+    set fh [open $path r]
+    set data [read $fh]
+    close $fh
+    return $data
+}
+
+# Lines of the first table following a "| <title>" banner
+proc report_summary::section_lines {text title} {
+    set lines [split $text "\n"]
+    set start [lsearch -regexp $lines "^\\|\\s*[string map {( \\( ) \\)} $title]\\s*$"]
+    if {$start < 0} {
+        return {}
+    }
+    return [lrange $lines [expr {$start + 1}] end]
+}
+
+#------------------------------------------------------------------------------
+# report_timing_summary
+#------------------------------------------------------------------------------
+proc report_summary::parse_timing {text} {
+    set r [dict create wns_ns "" tns_ns "" whs_ns "" ths_ns "" \
+                       clock "" period_ns "" fmax_mhz ""]
+
+    # Design Timing Summary: first numeric row after the dashed header
+    foreach line [section_lines $text "Design Timing Summary"] {
+        if {[regexp {^\s*(-?[0-9.]+|inf|NA)\s+(-?[0-9.]+|NA)\s+\d+\s+\d+\s+(-?[0-9.]+|inf|NA)\s+(-?[0-9.]+|NA)} \
+                $line -> wns tns whs ths]} {
+            dict set r wns_ns $wns
+            dict set r tns_ns $tns
+            dict set r whs_ns $whs
+            dict set r ths_ns $ths
+            break
+        }
+    }
+
+    # Clock Summary: primary clocks and their periods. Long generated clock
+    # names are printed flush against the waveform column, so no space is
+    # required before the waveform braces.
+    set periods [dict create]
+    set seen_table 0
+    foreach line [section_lines $text "Clock Summary"] {
+        if {[regexp {^\s*([^\s\{]+)\s*\{[0-9. ]+\}\s+([0-9.]+)\s+([0-9.]+)} $line -> clk period]} {
+            dict set periods $clk $period
+            set seen_table 1
+        } elseif {$seen_table && [string trim $line] eq ""} {
+            break
+        }
+    }
+
+    # Intra Clock Table: per-clock setup WNS, keep the worst one
+    set worst ""
+    set seen_table 0
+    foreach line [section_lines $text "Intra Clock Table"] {
+        if {[regexp {^\s*(\S+)\s+(-?[0-9.]+)\s+(-?[0-9.]+)\s+\d+\s+\d+} $line -> clk wns]} {
+            if {$worst eq "" || $wns < [lindex $worst 1]} {
+                set worst [list $clk $wns]
+            }
+            set seen_table 1
+        } elseif {$seen_table && [string trim $line] eq ""} {
+            break
+        }
+    }
+
+    if {$worst eq "" && [dict size $periods] > 0} {
+        set clk [lindex [dict keys $periods] 0]
+        set worst [list $clk [dict get $r wns_ns]]
+    }
+    if {$worst ne ""} {
+        lassign $worst clk wns
+        dict set r clock $clk
+        if {[dict exists $periods $clk] && [string is double -strict $wns]} {
+            set period [dict get $periods $clk]
+            dict set r period_ns $period
+            # Achieved Fmax: the clock period that would leave zero slack
+            set min_period [expr {$period - $wns}]
+            if {$min_period > 0} {
+                dict set r fmax_mhz [format %.2f [expr {1000.0 / $min_period}]]
+            }
+        }
+    }
+    return $r
+}
+
+#------------------------------------------------------------------------------
+# report_utilization
+#------------------------------------------------------------------------------
+proc report_summary::parse_utilization {text} {
+    set r [dict create lut "" ff "" bram "" uram "" dsp ""]
+    set map {
+        "CLB LUTs"       lut
+        "Slice LUTs"     lut
+        "CLB Registers"  ff
+        "Slice Registers" ff
+        "Block RAM Tile" bram
+        "URAM"           uram
+        "DSPs"           dsp
+    }
+
+    foreach line [split $text "\n"] {
+        if {![string match "|*|" [string trim $line]]} {
+            continue
+        }
+        set cols {}
+        foreach c [lrange [split [string trim $line] "|"] 1 end-1] {
+            lappend cols [string trim $c]
+        }
+        set name [string trimright [lindex $cols 0] "*"]
+        if {[dict exists $map $name]} {
+            set key [dict get $map $name]
+            # First table wins (the summary tables come before the details)
+            if {[dict get $r $key] eq "" && [string is double -strict [lindex $cols 1]]} {
+                dict set r $key [lindex $cols 1]
+            }
+        }
+    }
+    return $r
+}
+
+#------------------------------------------------------------------------------
+# JSON (flat objects only)
+#------------------------------------------------------------------------------
+proc report_summary::to_json {d} {
+    set items {}
+    dict for {k v} $d {
+        if {$v eq ""} {
+            lappend items "\"$k\": null"
+        } elseif {[string is double -strict $v]} {
+            lappend items "\"$k\": $v"
+        } else {
+            lappend items "\"$k\": \"[string map {\\ \\\\ \" \\\"} $v]\""
+        }
+    }
+    return "\{\n  [join $items ",\n  "]\n\}"
+}
+
+proc report_summary::from_json {text} {
+    set d [dict create]
+    foreach {-> k v} [regexp -all -inline \
+            {"([^"]+)"\s*:\s*("(?:[^"\\]|\\.)*"|-?[0-9.eE+]+|null|true|false)} $text] {
+        if {$v eq "null"} {
+            set v ""
+        } elseif {[string index $v 0] eq "\""} {
+            set v [string map {\\\" \" \\\\ \\} [string range $v 1 end-1]]
+        }
+        dict set d $k $v
+    }
+    return $d
+}
+
+#------------------------------------------------------------------------------
+# Build summary
+#------------------------------------------------------------------------------
+proc report_summary::summarize {variant timing_rpt util_rpt {build_time ""}} {
+    set d [dict create variant $variant]
+    set d [dict merge $d [parse_timing [read_file $timing_rpt]]]
+    set d [dict merge $d [parse_utilization [read_file $util_rpt]]]
+    dict set d build_time_s $build_time
+    return $d
+}
+
+proc report_summary::write {variant timing_rpt util_rpt build_time out_json} {
+    set d [summarize $variant $timing_rpt $util_rpt $build_time]
+    set fh [open $out_json w]
+    puts $fh [to_json $d]
+    close $fh
+
+    puts "======================================"
+    puts " Build Summary: $variant"
+    puts "======================================"
+    puts [format " WNS/TNS : %s / %s ns" [dict get $d wns_ns] [dict get $d tns_ns]]
+    puts [format " Fmax    : %s MHz (%s)" [dict get $d fmax_mhz] [dict get $d clock]]
+    puts [format " LUT/FF  : %s / %s" [dict get $d lut] [dict get $d ff]]
+    puts [format " BRAM/URAM/DSP : %s / %s / %s" \
+        [dict get $d bram] [dict get $d uram] [dict get $d dsp]]
+    puts " JSON    : $out_json"
+    return $d
+}
+
+#------------------------------------------------------------------------------
+# Standalone use
+#------------------------------------------------------------------------------
+if {[info exists ::argv0] && [file tail $::argv0] eq [file tail [info script]]} {
+    if {[llength $::argv] < 3} {
+        puts "Usage: tclsh report_summary.tcl <variant> <timing.rpt> <util.rpt> \[build_time_s\] \[out.json\]"
+        exit 1
+    }
+    lassign $::argv variant timing_rpt util_rpt build_time out_json
+    if {$out_json eq ""} {
+        puts [report_summary::to_json \
+            [report_summary::summarize $variant $timing_rpt $util_rpt $build_time]]
+    } else {
+        report_summary::write $variant $timing_rpt $util_rpt $build_time $out_json
+    }
+}
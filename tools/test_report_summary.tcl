@@ -0,0 +1,67 @@
+#==============================================================================
+# KV260 Build Variants - report_summary.tcl fixture check
+#
+# Parses the trimmed Vivado 2022.2 reports in tools/fixtures/ and compares the
+# extracted fields with the values in those reports (plain tclsh, no Vivado):
+#   tclsh tools/test_report_summary.tcl
+# Exit code 0 = all fields match.
+#==============================================================================
+
+set tools_dir [file dirname [file normalize [info script]]]
+source [file join $tools_dir report_summary.tcl]
+
+set fixtures [file join $tools_dir fixtures]
+set failures 0
+
+# case  timing report  utilization report  expected fields
+set cases {
+    "met, 100 MHz + ILA debug clock" timing_summary.rpt utilization.rpt {
+        wns_ns 5.123 tns_ns 0.000 whs_ns 0.010 ths_ns 0.000
+        clock clk_pl_0 period_ns 10.000 fmax_mhz 205.04
+        lut 3561 ff 5432 bram 7.5 uram 0 dsp 0
+    }
+    "failing, 300 MHz kernel build" timing_summary_fail.rpt utilization_fail.rpt {
+        wns_ns -0.412 tns_ns -18.337 whs_ns 0.011 ths_ns 0.000
+        clock clk_pl_0 period_ns 3.333 fmax_mhz 267.02
+        lut 2984 ff 4207 bram 2 uram 0 dsp 3
+    }
+    "long generated clock, no gap" timing_summary_genclk.rpt utilization.rpt {
+        wns_ns 0.734 tns_ns 0.000
+        clock design_1_i/zynq_ultra_ps_e_0/inst/pl_clk0_div/u_bram_port_b_clk/bram_port_b_clk_out_div2_gen
+        period_ns 5.000 fmax_mhz 234.41
+    }
+}
+
+foreach {name timing util expected} $cases {
+    set d [report_summary::summarize fixture \
+        [file join $fixtures $timing] [file join $fixtures $util] 0]
+    set bad {}
+    dict for {key want} $expected {
+        set got [dict get $d $key]
+        if {$got ne $want} {
+            lappend bad "$key = '$got' (expected '$want')"
+        }
+    }
+    if {[llength $bad] == 0} {
+        puts [format "  %-36s PASS" $name]
+    } else {
+        puts [format "  %-36s FAIL" $name]
+        foreach b $bad {
+            puts "      $b"
+        }
+        incr failures
+    }
+}
+
+# JSON round trip keeps every field
+set d [report_summary::summarize fixture \
+    [file join $fixtures timing_summary.rpt] [file join $fixtures utilization.rpt] 812]
+if {[report_summary::from_json [report_summary::to_json $d]] eq $d} {
+    puts [format "  %-36s PASS" "JSON round trip"]
+} else {
+    puts [format "  %-36s FAIL" "JSON round trip"]
+    incr failures
+}
+
+puts "report_summary fixtures: [expr {$failures == 0 ? "PASS" : "FAIL"}] ($failures failures)"
+exit [expr {$failures == 0 ? 0 : 1}]
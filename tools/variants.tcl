@@ -0,0 +1,47 @@
+#==============================================================================
+# KV260 Build Variants - shared variant table
+#
+# Sourced by build_variants.tcl (and other tools/ scripts).
+# Paths are relative to the repository root.
+#
+#   dir      : directory holding create_project.tcl / build_all.tcl
+#   project  : Vivado project name (created under dir)
+#   inputs   : glob patterns (relative to dir) hashed for incremental builds
+#              (every build_all.tcl sources tools/report_summary.tcl)
+#   options  : create_project.tcl -tclargs for this variant (also hashed)
+#   artifact : file produced by a successful build (relative to dir)
+#==============================================================================
+
+set VARIANTS [dict create \
+    pl_only_verilog [dict create \
+        dir      "00.kv260_led_project/01_PL_Only_Verilog" \
+        project  "kv260_led_pl_only" \
+        inputs   {create_project.tcl build_all.tcl src/* ../../tools/report_summary.tcl} \
+        options  {} \
+        artifact "design_1_wrapper.bit"] \
+    pl_only_vhdl [dict create \
+        dir      "00.kv260_led_project/01_PL_Only_VHDL" \
+        project  "kv260_led_pl_only" \
+        inputs   {create_project.tcl build_all.tcl src/* ../../tools/report_summary.tcl} \
+        options  {} \
+        artifact "design_1_wrapper.bit"] \
+    ps_pl_verilog [dict create \
+        dir      "00.kv260_led_project/02_PS_PL_Verilog" \
+        project  "kv260_led_ps_pl" \
+        inputs   {create_project.tcl build_all.tcl src/* ../../tools/report_summary.tcl} \
+        options  {} \
+        artifact "kv260_led_ps_pl.xsa"] \
+    ps_pl_vhdl [dict create \
+        dir      "00.kv260_led_project/02_PS_PL_VHDL" \
+        project  "kv260_led_ps_pl" \
+        inputs   {create_project.tcl build_all.tcl src/* ../../tools/report_summary.tcl} \
+        options  {} \
+        artifact "kv260_led_ps_pl.xsa"] \
+    bram_ila [dict create \
+        dir      "01.KRIA_BRAM_ILA/vivado" \
+        project  "kv260_bram_ila" \
+        inputs   {create_project.tcl build_all.tcl src/*.v
+                  ../hls/*.cpp ../hls/*.h ../hls/*.tcl ../../tools/report_summary.tcl} \
+        options  {-pl_clk 100 -ecc 0 -banks 1 -stream 0 -kernel 0} \
+        artifact "kv260_bram_ila/kv260_bram_ila.xsa"] \
+]